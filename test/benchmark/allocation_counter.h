@@ -0,0 +1,64 @@
+#pragma once
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+/**
+ * @brief Counts heap allocations made anywhere in the process.
+ *
+ * Replaces the global operator new/delete, so it measures allocator churn
+ * from scene building (Make factories, shared_ptr control blocks, node
+ * storage) and from per-frame work without touching CoreGene.
+ *
+ * Replacement operators must be defined exactly once per program: include
+ * this header (directly or through benchmark_harness.h) only from the
+ * benchmark's single translation unit.
+ *
+ * Usage:
+ * @code
+ * bench::AllocationStats before = bench::allocations();
+ * build_scene();
+ * bench::AllocationStats used = bench::allocations() - before;
+ * @endcode
+ */
+namespace bench {
+
+struct AllocationStats {
+    unsigned long long count = 0;
+    unsigned long long bytes = 0;
+
+    AllocationStats operator-(const AllocationStats& other) const {
+        return {count - other.count, bytes - other.bytes};
+    }
+};
+
+namespace detail {
+
+inline std::atomic<unsigned long long> allocation_count{0};
+inline std::atomic<unsigned long long> allocation_bytes{0};
+
+} // namespace detail
+
+inline AllocationStats allocations() {
+    return {detail::allocation_count.load(std::memory_order_relaxed),
+            detail::allocation_bytes.load(std::memory_order_relaxed)};
+}
+
+} // namespace bench
+
+// Array and nothrow forms forward to these by default
+void* operator new(std::size_t size) {
+    bench::detail::allocation_count.fetch_add(1, std::memory_order_relaxed);
+    bench::detail::allocation_bytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size ? size : 1)) return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept {
+    std::free(ptr);
+}
@@ -0,0 +1,380 @@
+#pragma once
+
+#include <EnGene.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+#include "../common/gl_call_counter.h"
+#include "allocation_counter.h"
+
+/**
+ * @brief Headless benchmark driver shared by the BenchmarkSuite targets.
+ *
+ * Runs a scene for a fixed number of frames with vsync off in a hidden
+ * window, then reports frame-time percentiles, per-frame GL call counts
+ * (draws, triangles, binds, state changes, uniform uploads), heap
+ * allocations and the GL objects alive when the report is written (see
+ * glstats::resources()) as JSON. Scene construction wrapped in
+ * beginSceneBuild() / endSceneBuild() is reported separately (time and
+ * allocations). Each frame is also split into simulation time (on_update
+ * bodies wrapped in beginUpdate() / endUpdate()) and render submission
+ * time (onFrame() to endFrame()); the rest is swap and event polling.
+ * Scene-specific values that qualify the numbers (e.g. how many lights were
+ * actually rendered) go in a "metrics" section through setMetric().
+ *
+ * Defines the global operator new (see allocation_counter.h), so include it
+ * from the benchmark's single translation unit only.
+ *
+ * Command line:
+ *   --frames N    measured frames (default 600)
+ *   --warmup N    frames skipped before measuring (default 60)
+ *   --scale N     node count multiplier passed to the scene (default 8)
+ *   --out FILE    also write the JSON report to FILE
+ *   --visible     keep the window visible (for checking the scene by eye)
+ *   --asset-root DIR  repository root for test assets (default: set by CMake)
+ *   --core-root DIR   CoreGene root for its shaders (default: set by CMake)
+ *
+ * Asset and shader paths go through assetPath() / corePath(), so the suite
+ * runs from any working directory. CMake defines BENCH_ASSET_ROOT and
+ * BENCH_COREGENE_ROOT as absolute paths; without them (or the options)
+ * paths stay relative to the working directory.
+ *
+ * Usage:
+ * @code
+ * bench::Harness harness("DepthBenchmark", bench::Options::Parse(argc, argv));
+ * harness.prepareWindow();                      // before constructing EnGene
+ * auto on_init = [&](engene::EnGene& app) {
+ *     harness.beginSceneBuild();
+ *     ...                                       // build the scene
+ *     harness.endSceneBuild();
+ *     harness.onInitialize();
+ * };
+ * auto on_update = [&](double dt) { harness.beginUpdate(); ...; harness.endUpdate(); };
+ * auto on_render = [&](double alpha) { harness.onFrame(); ...; harness.endFrame(); };
+ * engene::EnGene app(on_init, on_update, on_render, config);
+ * app.run();
+ * return harness.writeReport() ? 0 : 1;
+ * @endcode
+ */
+namespace bench {
+
+struct Options {
+    int frames = 600;
+    int warmup = 60;
+    int scale = 8;
+    std::string output;
+    bool visible = false;
+#ifdef BENCH_ASSET_ROOT
+    std::string asset_root = BENCH_ASSET_ROOT;
+#else
+    std::string asset_root;
+#endif
+#ifdef BENCH_COREGENE_ROOT
+    std::string core_root = BENCH_COREGENE_ROOT;
+#else
+    std::string core_root;
+#endif
+
+    static Options Parse(int argc, char** argv) {
+        Options options;
+        for (int i = 1; i < argc; i++) {
+            std::string arg = argv[i];
+            bool has_value = i + 1 < argc;
+
+            if (arg == "--frames" && has_value) {
+                options.frames = std::max(1, std::atoi(argv[++i]));
+            } else if (arg == "--warmup" && has_value) {
+                options.warmup = std::max(0, std::atoi(argv[++i]));
+            } else if (arg == "--scale" && has_value) {
+                options.scale = std::max(1, std::atoi(argv[++i]));
+            } else if (arg == "--out" && has_value) {
+                options.output = argv[++i];
+            } else if (arg == "--visible") {
+                options.visible = true;
+            } else if (arg == "--asset-root" && has_value) {
+                options.asset_root = argv[++i];
+            } else if (arg == "--core-root" && has_value) {
+                options.core_root = argv[++i];
+            } else {
+                std::cerr << "[BENCH] Ignoring unknown argument: " << arg << std::endl;
+            }
+        }
+        return options;
+    }
+};
+
+/**
+ * @brief Per-frame sample: wall time between frame starts, GL calls and heap allocations.
+ *
+ * update_ms and render_ms are the parts of frame_ms spent in fixed updates
+ * and in on_render; they stay 0 for scenes that don't mark them.
+ */
+struct FrameSample {
+    double frame_ms = 0.0;
+    double update_ms = 0.0;
+    double render_ms = 0.0;
+    glstats::Counters calls;
+    AllocationStats allocations;
+};
+
+class Harness {
+public:
+    Harness(const std::string& name, const Options& options)
+        : name_(name), options_(options) {
+        samples_.reserve(options_.frames);
+    }
+
+    const Options& options() const { return options_; }
+    int scale() const { return options_.scale; }
+
+    /// @p relative (e.g. "test/materials/skytest.png") under the repository root.
+    std::string assetPath(const std::string& relative) const {
+        return resolve(options_.asset_root, relative);
+    }
+
+    /// @p relative (e.g. "core_gene/shaders/fragment_fog.glsl") under the CoreGene root.
+    std::string corePath(const std::string& relative) const {
+        return resolve(options_.core_root, relative);
+    }
+
+    /**
+     * @brief Requests a hidden window. Call before constructing engene::EnGene.
+     *
+     * glfwInit() is idempotent, so initializing here lets the hint survive
+     * until EnGene creates its window.
+     */
+    void prepareWindow() {
+        if (options_.visible) return;
+        if (glfwInit() == GLFW_TRUE) {
+            glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+        }
+    }
+
+    /**
+     * @brief Starts timing scene construction (node creation, geometry, shaders).
+     */
+    void beginSceneBuild() {
+        // Installed here so resources() also covers what the scene creates
+        glstats::install();
+        build_start_ = std::chrono::steady_clock::now();
+        build_allocations_ = allocations();
+    }
+
+    void endSceneBuild() {
+        build_ms_ = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - build_start_).count();
+        build_allocations_ = allocations() - build_allocations_;
+    }
+
+    /**
+     * @brief Brackets one fixed update step. Steps accumulate until the next onFrame().
+     */
+    void beginUpdate() {
+        update_start_ = std::chrono::steady_clock::now();
+    }
+
+    void endUpdate() {
+        update_ms_ += std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - update_start_).count();
+    }
+
+    /**
+     * @brief Finishes setup once the context is current. Call at the end of on_initialize.
+     */
+    void onInitialize() {
+        GLFWwindow* window = glfwGetCurrentContext();
+        if (window && !options_.visible) {
+            glfwHideWindow(window);
+        }
+        glfwSwapInterval(0);
+
+        glstats::install();
+        glstats::reset();
+    }
+
+    /**
+     * @brief Marks a frame boundary. Call first thing in on_render.
+     *
+     * The previous frame's sample covers everything since the last call:
+     * fixed updates, render, swap and event polling.
+     */
+    void onFrame() {
+        auto now = std::chrono::steady_clock::now();
+        AllocationStats allocated = allocations();
+
+        // frame_count_ > warmup >= 0 also guarantees last_frame_ is set.
+        // Frames rendered after the close request are not sampled.
+        bool measuring = static_cast<int>(samples_.size()) < options_.frames;
+        if (measuring && frame_count_ > options_.warmup) {
+            FrameSample sample;
+            sample.frame_ms = std::chrono::duration<double, std::milli>(now - last_frame_).count();
+            sample.update_ms = update_ms_;
+            sample.render_ms = render_ms_;
+            sample.calls = glstats::counters();
+            sample.allocations = allocated - last_allocations_;
+            samples_.push_back(sample);
+        }
+        glstats::reset();
+        update_ms_ = 0.0;
+        render_ms_ = 0.0;
+        last_frame_ = now;
+        // Re-read so the push_back above is not charged to the next frame
+        last_allocations_ = allocations();
+        frame_count_++;
+
+        if (static_cast<int>(samples_.size()) >= options_.frames) {
+            if (GLFWwindow* window = glfwGetCurrentContext()) {
+                glfwSetWindowShouldClose(window, GLFW_TRUE);
+            }
+        }
+    }
+
+    /**
+     * @brief Marks the end of render submission. Call last thing in on_render.
+     */
+    void endFrame() {
+        render_ms_ = std::chrono::duration<double, std::milli>(
+            std::chrono::steady_clock::now() - last_frame_).count();
+    }
+
+    /**
+     * @brief Records a named value for the report's "metrics" section; setting it again replaces it.
+     */
+    void setMetric(const std::string& name, double value) {
+        for (auto& metric : metrics_) {
+            if (metric.first == name) {
+                metric.second = value;
+                return;
+            }
+        }
+        metrics_.emplace_back(name, value);
+    }
+
+    /**
+     * @brief Prints the JSON report to stdout and, with --out, to a file.
+     * @return false if no frames were measured or the output file failed.
+     */
+    bool writeReport() const {
+        if (samples_.empty()) {
+            std::cerr << "[BENCH] " << name_ << ": no frames measured" << std::endl;
+            return false;
+        }
+
+        std::string json = toJson();
+        std::cout << json << std::endl;
+
+        if (!options_.output.empty()) {
+            std::ofstream file(options_.output);
+            if (!file.is_open()) {
+                std::cerr << "[BENCH] Failed to open " << options_.output << std::endl;
+                return false;
+            }
+            file << json << std::endl;
+        }
+        return true;
+    }
+
+private:
+    static std::string resolve(const std::string& root, const std::string& relative) {
+        if (root.empty()) return relative;
+        return (std::filesystem::path(root) / relative).string();
+    }
+
+    static double percentile(const std::vector<double>& sorted, double p) {
+        // Nearest-rank percentile on an ascending vector
+        size_t rank = static_cast<size_t>(p / 100.0 * (sorted.size() - 1) + 0.5);
+        return sorted[std::min(rank, sorted.size() - 1)];
+    }
+
+    // Writes "mean", "min", percentiles and "max" of a set of durations
+    static void writeTimes(std::ostream& out, std::vector<double> times) {
+        double total_ms = 0.0;
+        for (double time : times) total_ms += time;
+        std::sort(times.begin(), times.end());
+
+        out << "{\"mean\": " << total_ms / times.size()
+            << ", \"min\": " << times.front()
+            << ", \"p50\": " << percentile(times, 50.0)
+            << ", \"p90\": " << percentile(times, 90.0)
+            << ", \"p95\": " << percentile(times, 95.0)
+            << ", \"p99\": " << percentile(times, 99.0)
+            << ", \"max\": " << times.back() << "}";
+    }
+
+    std::string toJson() const {
+        std::vector<double> times, update_times, render_times;
+        times.reserve(samples_.size());
+        update_times.reserve(samples_.size());
+        render_times.reserve(samples_.size());
+        glstats::Counters sum;
+        AllocationStats allocated;
+        for (const auto& sample : samples_) {
+            times.push_back(sample.frame_ms);
+            update_times.push_back(sample.update_ms);
+            render_times.push_back(sample.render_ms);
+            sum += sample.calls;
+            allocated.count += sample.allocations.count;
+            allocated.bytes += sample.allocations.bytes;
+        }
+
+        double n = static_cast<double>(samples_.size());
+        std::ostringstream out;
+        out << std::fixed << std::setprecision(3);
+        out << "{\n"
+            << "  \"benchmark\": \"" << name_ << "\",\n"
+            << "  \"scale\": " << options_.scale << ",\n"
+            << "  \"frames\": " << samples_.size() << ",\n"
+            << "  \"scene_build\": {"
+            << "\"ms\": " << build_ms_
+            << ", \"allocations\": " << build_allocations_.count
+            << ", \"allocated_bytes\": " << build_allocations_.bytes << "},\n"
+            << "  \"frame_ms\": ";
+        writeTimes(out, times);
+        out << ",\n  \"update_ms\": ";
+        writeTimes(out, update_times);
+        out << ",\n  \"render_ms\": ";
+        writeTimes(out, render_times);
+        out << ",\n"
+            << "  \"per_frame\": {";
+        glstats::forEachCounter(sum, [&](const char* name, unsigned long long value) {
+            out << "\"" << name << "\": " << value / n << ", ";
+        });
+        out << "\"allocations\": " << allocated.count / n
+            << ", \"allocated_bytes\": " << allocated.bytes / n << "},\n"
+            << "  \"resources\": ";
+        glstats::writeJson(out, glstats::resources());
+        if (!metrics_.empty()) {
+            out << ",\n  \"metrics\": {";
+            for (size_t i = 0; i < metrics_.size(); i++) {
+                out << (i ? ", " : "") << "\"" << metrics_[i].first << "\": " << metrics_[i].second;
+            }
+            out << "}";
+        }
+        out << "\n}";
+        return out.str();
+    }
+
+    std::string name_;
+    Options options_;
+    std::vector<FrameSample> samples_;
+    std::vector<std::pair<std::string, double>> metrics_;
+    std::chrono::steady_clock::time_point last_frame_;
+    AllocationStats last_allocations_;
+    std::chrono::steady_clock::time_point update_start_;
+    double update_ms_ = 0.0;
+    double render_ms_ = 0.0;
+    std::chrono::steady_clock::time_point build_start_;
+    AllocationStats build_allocations_;
+    double build_ms_ = 0.0;
+    int frame_count_ = 0;
+};
+
+} // namespace bench
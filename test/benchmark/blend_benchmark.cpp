@@ -0,0 +1,180 @@
+#include <iostream>
+#include <vector>
+#include <EnGene.h>
+#include <core/scene_node_builder.h>
+#include <components/all.h>
+#include <gl_base/error.h>
+#include <gl_base/framebuffer.h>
+#include <3d/camera/perspective_camera.h>
+#include <other_genes/3d_shapes/cube.h>
+#include "benchmark_harness.h"
+
+// BlendTest shaders with the unused fragPos varying dropped
+const char* BLEND_BENCHMARK_VERTEX_SHADER = R"(
+    #version 410 core
+    layout (location = 0) in vec4 vertex;
+    layout (location = 1) in vec3 normal;
+
+    out vec3 fragNormal;
+
+    layout (std140) uniform CameraMatrices {
+        mat4 view;
+        mat4 projection;
+    };
+
+    uniform mat4 u_model;
+
+    void main() {
+        fragNormal = mat3(transpose(inverse(u_model))) * normal;
+        gl_Position = projection * view * u_model * vertex;
+    }
+)";
+
+const char* BLEND_BENCHMARK_FRAGMENT_SHADER = R"(
+    #version 410 core
+
+    in vec3 fragNormal;
+    out vec4 fragColor;
+
+    uniform vec4 color;
+
+    void main() {
+        vec3 lightDir = normalize(vec3(1.0, 1.0, 1.0));
+        float diff = max(dot(normalize(fragNormal), lightDir), 0.0);
+        fragColor = vec4((0.3 + diff) * color.rgb, color.a);
+    }
+)";
+
+/**
+ * @brief Benchmark version of BlendTest's scene.
+ *
+ * The three overlapping, semi-transparent spinning cubes of BlendTest are
+ * replicated scale x scale times on a grid and drawn with standard alpha
+ * blending (SrcAlpha, OneMinusSrcAlpha). As in BlendTest, each cluster is
+ * added farthest cube first, so insertion order is back-to-front for the
+ * fixed camera and every overlap is blended rather than depth-rejected.
+ *
+ * Workload:
+ * - Blended overdraw (fill-rate bound at high scale)
+ * - Per-node transform updates every fixed step
+ * - 3 materials shared across all clusters
+ *
+ * Usage: BlendBenchmark [--frames N] [--warmup N] [--scale N] [--out FILE] [--visible]
+ */
+
+struct CubeSpec {
+    glm::vec3 offset;
+    glm::vec4 color;
+    float speed;    // rotation speed multiplier, BlendTest's cube number
+};
+
+// Cluster layout taken from BlendTest, in its draw order: cube3, cube2, cube1 (back to front)
+const CubeSpec CLUSTER[] = {
+    {glm::vec3(1.0f, 0.0f, -0.5f), glm::vec4(0.0f, 0.0f, 1.0f, 0.5f), 3.0f},
+    {glm::vec3(0.0f, 0.0f, 0.0f), glm::vec4(0.0f, 1.0f, 0.0f, 0.5f), 2.0f},
+    {glm::vec3(-1.0f, 0.0f, 0.5f), glm::vec4(1.0f, 0.0f, 0.0f, 0.5f), 1.0f}
+};
+const int CLUSTER_SIZE = sizeof(CLUSTER) / sizeof(CLUSTER[0]);
+const float CLUSTER_SPACING = 3.5f;
+
+// Rotating transforms with their cube's speed, kept directly instead of looked up by name each step
+struct SpinningCube {
+    std::shared_ptr<transform::Transform> transform;
+    float speed;
+};
+std::vector<SpinningCube> g_spinning;
+
+int main(int argc, char** argv) {
+    bench::Harness harness("BlendBenchmark", bench::Options::Parse(argc, argv));
+    int scale = harness.scale();
+
+    auto on_init = [&](engene::EnGene& app) {
+        harness.beginSceneBuild();
+
+        auto cube_geom = Cube::Make(1.0f, 1.0f, 1.0f);
+
+        std::vector<material::MaterialPtr> materials;
+        for (const auto& spec : CLUSTER) {
+            auto mat = material::Material::Make(glm::vec3(spec.color));
+            mat->set("color", spec.color);
+            materials.push_back(mat);
+        }
+
+        float half_extent = (scale - 1) * CLUSTER_SPACING * 0.5f;
+        for (int gx = 0; gx < scale; gx++) {
+            for (int gy = 0; gy < scale; gy++) {
+                glm::vec3 center(gx * CLUSTER_SPACING - half_extent,
+                                 gy * CLUSTER_SPACING - half_extent,
+                                 -5.0f - 2.0f * half_extent);
+                for (int i = 0; i < CLUSTER_SIZE; i++) {
+                    glm::vec3 p = center + CLUSTER[i].offset;
+                    auto transform = transform::Transform::Make();
+                    transform->setTranslate(p.x, p.y, p.z);
+                    g_spinning.push_back({transform, CLUSTER[i].speed});
+
+                    scene::graph()->addNode("cube_" + std::to_string(gx) + "_" + std::to_string(gy) + "_" + std::to_string(i))
+                        .with<component::TransformComponent>(transform)
+                        .with<component::MaterialComponent>(materials[i])
+                        .with<component::GeometryComponent>(cube_geom);
+                }
+            }
+        }
+
+        auto camera = component::PerspectiveCamera::Make(60.0f, 0.1f, 100.0f);
+        scene::graph()->setActiveCamera(camera);
+
+        framebuffer::stack()->blend().setEnabled(true);
+        framebuffer::stack()->blend().setEquation(framebuffer::BlendEquation::Add);
+        framebuffer::stack()->blend().setFunction(
+            framebuffer::BlendFactor::SrcAlpha,
+            framebuffer::BlendFactor::OneMinusSrcAlpha);
+
+        auto base_shader = app.getBaseShader();
+        base_shader->configureDynamicUniform<glm::mat4>("u_model", transform::current);
+        base_shader->configureDynamicUniform<glm::vec4>("color", material::stack()->getProvider<glm::vec4>("color"));
+        base_shader->Bake();
+
+        harness.endSceneBuild();
+        std::cout << "[INIT] " << g_spinning.size() << " transparent cubes" << std::endl;
+        harness.onInitialize();
+    };
+
+    auto on_update = [&](double dt) {
+        harness.beginUpdate();
+        for (const auto& cube : g_spinning) {
+            cube.transform->rotate(static_cast<float>(dt * 30.0) * cube.speed, 0.0f, 1.0f, 0.0f);
+            cube.transform->rotate(static_cast<float>(dt * 20.0) * cube.speed, 1.0f, 0.0f, 0.0f);
+        }
+        harness.endUpdate();
+    };
+
+    auto on_render = [&](double alpha) {
+        harness.onFrame();
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        scene::graph()->draw();
+        GL_CHECK("render");
+        harness.endFrame();
+    };
+
+    engene::EnGeneConfig config;
+    config.title = "Blend Benchmark";
+    config.width = 1024;
+    config.height = 768;
+    config.clearColor[0] = 0.1f;
+    config.clearColor[1] = 0.1f;
+    config.clearColor[2] = 0.1f;
+    config.clearColor[3] = 1.0f;
+    config.base_vertex_shader_source = BLEND_BENCHMARK_VERTEX_SHADER;
+    config.base_fragment_shader_source = BLEND_BENCHMARK_FRAGMENT_SHADER;
+
+    try {
+        harness.prepareWindow();
+        engene::EnGene app(on_init, on_update, on_render, config);
+        app.run();
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Benchmark failed: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return harness.writeReport() ? 0 : 1;
+}
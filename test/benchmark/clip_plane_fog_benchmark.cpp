@@ -0,0 +1,193 @@
+#include <iostream>
+#include <cmath>
+#include <EnGene.h>
+#include <core/scene_node_builder.h>
+#include <components/all.h>
+#include <gl_base/error.h>
+#include <3d/camera/perspective_camera.h>
+#include <3d/lights/directional_light.h>
+#include <3d/lights/point_light.h>
+#include <other_genes/3d_shapes/sphere.h>
+#include "benchmark_harness.h"
+#include "../common/fog_shader.h"
+
+/**
+ * @brief Benchmark version of ClipPlaneFogTest's scene.
+ *
+ * ClipPlaneFogTest's row of clipped spheres (two planes, one plane, none)
+ * and its fog spheres are replicated scale x scale times under one fog
+ * shader and one material, lit by a directional and two point lights.
+ *
+ * Workload:
+ * - Per-node ClipPlaneComponent uniform uploads
+ * - High-tessellation spheres (Sphere 32 x 64) under multi-light shading
+ * - Shared shader/material state on a single group node
+ *
+ * Loads ClipPlaneFogTest's shaders through harness.corePath().
+ *
+ * Built a second time as ClipPlaneFogLodBenchmark (CLIP_PLANE_FOG_LOD=1),
+ * where each sphere is drawn at 32 x 64, 16 x 32 or 8 x 16 by its distance
+ * from the fixed camera. The two reports share a workload otherwise, so
+ * comparing them shows what distance LOD saves; ClipPlaneFogBenchmark's own
+ * numbers stay comparable with earlier runs.
+ *
+ * Usage: ClipPlaneFogBenchmark [--frames N] [--warmup N] [--scale N] [--out FILE] [--visible]
+ */
+
+const float CLUSTER_SPACING = 10.0f;
+const int FOG_SPHERES_PER_CLUSTER = 5;
+const glm::vec3 CAMERA_POSITION(0.0f, 6.0f, 12.0f);
+
+#ifndef CLIP_PLANE_FOG_LOD
+#define CLIP_PLANE_FOG_LOD 0
+#endif
+
+int main(int argc, char** argv) {
+    bench::Harness harness(CLIP_PLANE_FOG_LOD ? "ClipPlaneFogLodBenchmark" : "ClipPlaneFogBenchmark",
+                           bench::Options::Parse(argc, argv));
+    int scale = harness.scale();
+
+    shader::ShaderPtr fog_shader;
+
+    auto on_init = [&](engene::EnGene& app) {
+        harness.beginSceneBuild();
+
+        // Lights first so the SceneLights UBO exists when the shader is baked
+        light::DirectionalLightParams dir_params;
+        dir_params.base_direction = glm::vec3(-0.5f, -1.0f, -0.3f);
+        dir_params.ambient = glm::vec4(0.2f, 0.2f, 0.25f, 1.0f);
+        dir_params.diffuse = glm::vec4(0.6f, 0.6f, 0.7f, 1.0f);
+        dir_params.specular = glm::vec4(0.3f, 0.3f, 0.4f, 1.0f);
+        scene::graph()->addNode("dir_light")
+            .with<component::LightComponent>(
+                light::DirectionalLight::Make(dir_params), transform::Transform::Make());
+
+        for (int i = 0; i < 2; i++) {
+            light::PointLightParams point_params;
+            point_params.position = glm::vec4(i == 0 ? -5.0f : 5.0f, 3.0f, 0.0f, 1.0f);
+            point_params.ambient = glm::vec4(0.05f, 0.05f, 0.05f, 1.0f);
+            point_params.diffuse = i == 0 ? glm::vec4(1.0f, 0.2f, 0.2f, 1.0f) : glm::vec4(0.2f, 1.0f, 0.2f, 1.0f);
+            point_params.specular = glm::vec4(0.5f, 0.5f, 0.5f, 1.0f);
+            point_params.constant = 1.0f;
+            point_params.linear = 0.09f;
+            point_params.quadratic = 0.032f;
+            scene::graph()->addNode("point_light" + std::to_string(i + 1))
+                .with<component::LightComponent>(
+                    light::PointLight::Make(point_params), transform::Transform::Make());
+        }
+
+        // Texture flags compiled in rather than uploaded, as in ClipPlaneFogTest
+        auto fog_variants = fogshader::makeVariants(
+            harness.corePath("core_gene/shaders/clip_plane_vertex.glsl"),
+            harness.corePath("core_gene/shaders/fragment_fog.glsl"),
+            glm::vec3(0.5f, 0.6f, 0.7f), 0.08f);
+        fog_shader = fog_variants.get<variants::mask<>>();
+
+        // Distance-based tessellation (LOD build only). The camera is fixed,
+        // so each node's level is chosen once here.
+        auto sphere_geom = Sphere::Make(1.0f, 32, 64);
+        decltype(sphere_geom) medium_sphere_geom, far_sphere_geom;
+        if (CLIP_PLANE_FOG_LOD) {
+            medium_sphere_geom = Sphere::Make(1.0f, 16, 32);
+            far_sphere_geom = Sphere::Make(1.0f, 8, 16);
+        }
+        auto sphereAt = [&](float x, float y, float z) {
+            float distance = glm::length(glm::vec3(x, y, z) - CAMERA_POSITION);
+            if (!CLIP_PLANE_FOG_LOD || distance < 20.0f) return sphere_geom;
+            if (distance < 40.0f) return medium_sphere_geom;
+            return far_sphere_geom;
+        };
+
+        auto base_material = material::Material::Make(glm::vec3(0.8f, 0.8f, 0.8f));
+        base_material->setShininess(64.0f);
+
+        auto& fog_group = scene::graph()->addNode("fog_spheres")
+            .with<component::ShaderComponent>(fog_shader)
+            .with<component::MaterialComponent>(base_material);
+
+        int sphere_count = 0;
+        float half_extent = (scale - 1) * CLUSTER_SPACING * 0.5f;
+        for (int cx = 0; cx < scale; cx++) {
+            for (int cz = 0; cz < scale; cz++) {
+                std::string prefix = "cluster_" + std::to_string(cx) + "_" + std::to_string(cz);
+                float ox = cx * CLUSTER_SPACING - half_extent;
+                float oz = -cz * CLUSTER_SPACING;
+
+                // Same three clip configurations as ClipPlaneFogTest
+                auto center_clip = component::ClipPlaneComponent::Make("clip_planes", "num_clip_planes");
+                center_clip->addPlane(1.0f, 0.0f, 0.0f, 0.0f);
+                center_clip->addPlane(0.0f, 1.0f, 0.0f, 0.0f);
+                fog_group.addNode(prefix + "_center")
+                    .with<component::TransformComponent>(
+                        transform::Transform::Make()->translate(ox, 0.0f, oz)->scale(2.0f, 2.0f, 2.0f))
+                    .addComponent(center_clip)
+                    .addComponent(component::GeometryComponent::Make(sphereAt(ox, 0.0f, oz)));
+
+                auto left_clip = component::ClipPlaneComponent::Make("clip_planes", "num_clip_planes");
+                left_clip->addPlane(0.0f, 0.0f, 1.0f, 0.0f);
+                fog_group.addNode(prefix + "_left")
+                    .with<component::TransformComponent>(
+                        transform::Transform::Make()->translate(ox - 4.0f, 0.0f, oz)->scale(1.5f, 1.5f, 1.5f))
+                    .addComponent(left_clip)
+                    .addComponent(component::GeometryComponent::Make(sphereAt(ox - 4.0f, 0.0f, oz)));
+
+                fog_group.addNode(prefix + "_right")
+                    .with<component::TransformComponent>(
+                        transform::Transform::Make()->translate(ox + 4.0f, 0.0f, oz)->scale(1.5f, 1.5f, 1.5f))
+                    .addComponent(component::ClipPlaneComponent::Make("clip_planes", "num_clip_planes"))
+                    .addComponent(component::GeometryComponent::Make(sphereAt(ox + 4.0f, 0.0f, oz)));
+
+                for (int i = 0; i < FOG_SPHERES_PER_CLUSTER; i++) {
+                    fog_group.addNode(prefix + "_fog_" + std::to_string(i))
+                        .with<component::TransformComponent>(
+                            transform::Transform::Make()->translate(ox, 3.0f, oz - 1.5f * i))
+                        .addComponent(component::ClipPlaneComponent::Make("clip_planes", "num_clip_planes"))
+                        .addComponent(component::GeometryComponent::Make(sphereAt(ox, 3.0f, oz - 1.5f * i)));
+                }
+                sphere_count += 3 + FOG_SPHERES_PER_CLUSTER;
+            }
+        }
+
+        auto camera = component::PerspectiveCamera::Make(60.0f, 1.0f, 1000.0f);
+        camera->getTransform()->setTranslate(CAMERA_POSITION.x, CAMERA_POSITION.y, CAMERA_POSITION.z);
+        scene::graph()->setActiveCamera(camera);
+
+        light::manager().apply();
+
+        harness.endSceneBuild();
+        std::cout << "[INIT] " << sphere_count << " fogged spheres" << std::endl;
+        harness.onInitialize();
+    };
+
+    auto on_update = [](double dt) {
+        // Static scene; the camera does not move
+    };
+
+    auto on_render = [&](double alpha) {
+        harness.onFrame();
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        scene::graph()->draw();
+        GL_CHECK("render");
+        harness.endFrame();
+    };
+
+    engene::EnGeneConfig config;
+    config.title = "Clip Plane & Fog Benchmark";
+    config.width = 1280;
+    config.height = 720;
+    config.clearColor[0] = 0.5f;
+    config.clearColor[1] = 0.6f;
+    config.clearColor[2] = 0.7f;
+    config.clearColor[3] = 1.0f;
+
+    try {
+        harness.prepareWindow();
+        engene::EnGene app(on_init, on_update, on_render, config);
+        app.run();
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Benchmark failed: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return harness.writeReport() ? 0 : 1;
+}
@@ -0,0 +1,185 @@
+#include <iostream>
+#include <vector>
+#include <EnGene.h>
+#include <core/scene_node_builder.h>
+#include <components/all.h>
+#include <gl_base/error.h>
+#include <gl_base/framebuffer.h>
+#include <3d/camera/perspective_camera.h>
+#include <other_genes/3d_shapes/cube.h>
+#include "benchmark_harness.h"
+
+// DepthTest shaders with the unused fragPos varying dropped
+const char* DEPTH_BENCHMARK_VERTEX_SHADER = R"(
+    #version 410 core
+    layout (location = 0) in vec4 vertex;
+    layout (location = 1) in vec3 normal;
+
+    out vec3 fragNormal;
+
+    layout (std140) uniform CameraMatrices {
+        mat4 view;
+        mat4 projection;
+    };
+
+    uniform mat4 u_model;
+
+    void main() {
+        fragNormal = mat3(transpose(inverse(u_model))) * normal;
+        gl_Position = projection * view * u_model * vertex;
+    }
+)";
+
+const char* DEPTH_BENCHMARK_FRAGMENT_SHADER = R"(
+    #version 410 core
+
+    in vec3 fragNormal;
+    out vec4 fragColor;
+
+    uniform vec4 color;
+
+    void main() {
+        vec3 lightDir = normalize(vec3(1.0, 1.0, 1.0));
+        float diff = max(dot(normalize(fragNormal), lightDir), 0.0);
+        fragColor = vec4((0.3 + diff) * color.rgb, color.a);
+    }
+)";
+
+/**
+ * @brief Benchmark version of DepthTest's scene.
+ *
+ * The five overlapping, spinning cubes of DepthTest are replicated
+ * scale x scale times on a grid (plus the far wall behind the far plane),
+ * rendered with standard Less depth testing.
+ *
+ * Workload:
+ * - Opaque overdraw resolved by the depth buffer
+ * - Per-node transform updates every fixed step
+ * - 5 materials shared across all clusters
+ *
+ * Usage: DepthBenchmark [--frames N] [--warmup N] [--scale N] [--out FILE] [--visible]
+ */
+
+struct CubeSpec {
+    glm::vec3 offset;
+    glm::vec4 color;
+};
+
+// Cluster layout taken from DepthTest (cube1..cube5)
+const CubeSpec CLUSTER[] = {
+    {glm::vec3(-1.5f, 0.0f, 1.0f), glm::vec4(1.0f, 0.0f, 0.0f, 1.0f)},
+    {glm::vec3(0.0f, 0.0f, 0.0f), glm::vec4(0.0f, 1.0f, 0.0f, 1.0f)},
+    {glm::vec3(1.5f, 0.0f, -1.0f), glm::vec4(0.0f, 0.0f, 1.0f, 1.0f)},
+    {glm::vec3(0.5f, 0.5f, -0.2f), glm::vec4(1.0f, 1.0f, 0.0f, 1.0f)},
+    {glm::vec3(-1.0f, -0.5f, 0.7f), glm::vec4(0.0f, 1.0f, 1.0f, 1.0f)}
+};
+const int CLUSTER_SIZE = sizeof(CLUSTER) / sizeof(CLUSTER[0]);
+const float CLUSTER_SPACING = 4.0f;
+
+// Rotating transforms, kept directly instead of looked up by name each step
+std::vector<std::shared_ptr<transform::Transform>> g_spinning;
+
+int main(int argc, char** argv) {
+    bench::Harness harness("DepthBenchmark", bench::Options::Parse(argc, argv));
+    int scale = harness.scale();
+
+    auto on_init = [&](engene::EnGene& app) {
+        harness.beginSceneBuild();
+
+        auto cube_geom = Cube::Make(1.0f, 1.0f, 1.0f);
+
+        std::vector<material::MaterialPtr> materials;
+        for (const auto& spec : CLUSTER) {
+            auto mat = material::Material::Make(glm::vec3(spec.color));
+            mat->set("color", spec.color);
+            materials.push_back(mat);
+        }
+
+        float half_extent = (scale - 1) * CLUSTER_SPACING * 0.5f;
+        for (int gx = 0; gx < scale; gx++) {
+            for (int gy = 0; gy < scale; gy++) {
+                glm::vec3 center(gx * CLUSTER_SPACING - half_extent,
+                                 gy * CLUSTER_SPACING - half_extent,
+                                 -5.0f - 2.0f * half_extent);
+                for (int i = 0; i < CLUSTER_SIZE; i++) {
+                    glm::vec3 p = center + CLUSTER[i].offset;
+                    auto transform = transform::Transform::Make();
+                    transform->setTranslate(p.x, p.y, p.z);
+                    g_spinning.push_back(transform);
+
+                    scene::graph()->addNode("cube_" + std::to_string(gx) + "_" + std::to_string(gy) + "_" + std::to_string(i))
+                        .with<component::TransformComponent>(transform)
+                        .with<component::MaterialComponent>(materials[i])
+                        .with<component::GeometryComponent>(cube_geom);
+                }
+            }
+        }
+
+        // Far wall behind the far plane, as in DepthTest
+        auto wall_material = material::Material::Make(glm::vec3(1.0f, 0.0f, 1.0f));
+        wall_material->set("color", glm::vec4(1.0f, 0.0f, 1.0f, 1.0f));
+        scene::graph()->addNode("far_wall")
+            .with<component::TransformComponent>(
+                transform::Transform::Make()
+                    ->setTranslate(0.0f, 0.0f, -110.0f)
+                    ->scale(50.0f, 50.0f, 1.0f))
+            .with<component::MaterialComponent>(wall_material)
+            .with<component::GeometryComponent>(cube_geom);
+
+        auto camera = component::PerspectiveCamera::Make(60.0f, 0.1f, 100.0f);
+        scene::graph()->setActiveCamera(camera);
+
+        framebuffer::stack()->depth().setTest(true);
+        framebuffer::stack()->depth().setWrite(true);
+        framebuffer::stack()->depth().setFunction(framebuffer::DepthFunc::Less);
+
+        auto base_shader = app.getBaseShader();
+        base_shader->configureDynamicUniform<glm::mat4>("u_model", transform::current);
+        base_shader->configureDynamicUniform<glm::vec4>("color", material::stack()->getProvider<glm::vec4>("color"));
+        base_shader->Bake();
+
+        harness.endSceneBuild();
+        std::cout << "[INIT] " << g_spinning.size() + 1 << " cubes" << std::endl;
+        harness.onInitialize();
+    };
+
+    auto on_update = [&](double dt) {
+        harness.beginUpdate();
+        for (size_t i = 0; i < g_spinning.size(); i++) {
+            float speed = static_cast<float>(i % CLUSTER_SIZE + 1);
+            g_spinning[i]->rotate(static_cast<float>(dt * 20.0) * speed, 0.0f, 1.0f, 0.0f);
+            g_spinning[i]->rotate(static_cast<float>(dt * 15.0) * speed, 1.0f, 0.0f, 0.0f);
+        }
+        harness.endUpdate();
+    };
+
+    auto on_render = [&](double alpha) {
+        harness.onFrame();
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        scene::graph()->draw();
+        GL_CHECK("render");
+        harness.endFrame();
+    };
+
+    engene::EnGeneConfig config;
+    config.title = "Depth Benchmark";
+    config.width = 1024;
+    config.height = 768;
+    config.clearColor[0] = 0.1f;
+    config.clearColor[1] = 0.1f;
+    config.clearColor[2] = 0.1f;
+    config.clearColor[3] = 1.0f;
+    config.base_vertex_shader_source = DEPTH_BENCHMARK_VERTEX_SHADER;
+    config.base_fragment_shader_source = DEPTH_BENCHMARK_FRAGMENT_SHADER;
+
+    try {
+        harness.prepareWindow();
+        engene::EnGene app(on_init, on_update, on_render, config);
+        app.run();
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Benchmark failed: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return harness.writeReport() ? 0 : 1;
+}
@@ -0,0 +1,255 @@
+#include <iostream>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <EnGene.h>
+#include <gl_base/error.h>
+#include <gl_base/framebuffer.h>
+#include "benchmark_harness.h"
+#include "../common/stream_buffer.h"
+
+/**
+ * @brief Dynamic geometry benchmark: a cloth mesh rewritten on every frame.
+ *
+ * A (scale * 32) x (scale * 32) vertex grid is displaced by travelling
+ * waves on the CPU in every fixed update, written straight into a
+ * stream::RingBuffer's data(). Each frame the whole grid is uploaded to
+ * the next segment (triple-buffered, unsynchronized mapping, explicit
+ * flush) and drawn with one indexed draw. The index buffer
+ * and VAO layout are created once; only the vertex segment offset changes.
+ *
+ * geometry::Geometry has no update path, so the cloth uses its own VAO and
+ * program; the engine provides the window, the loop and the depth state.
+ * Compare update_ms (CPU deformation) with render_ms (mapping, copy and
+ * draw submission), and check metrics.streaming_stalls in the report
+ * (upload() waits on the GPU, warmup included): it should be 0.
+ *
+ * Workload:
+ * - (scale * 32)^2 * 24 bytes streamed per frame (position + normal)
+ * - One indexed draw of 2 * (scale * 32 - 1)^2 triangles
+ *
+ * Usage: DynamicGeometryBenchmark [--frames N] [--warmup N] [--scale N] [--out FILE] [--visible]
+ */
+
+const float CLOTH_SIZE = 20.0f;        // World units per cloth side
+const float WAVE_HEIGHT = 0.6f;
+
+const char* CLOTH_VERTEX_SHADER = R"(
+    #version 410 core
+    layout (location = 0) in vec3 position;
+    layout (location = 1) in vec3 normal;
+
+    out vec3 fragNormal;
+
+    uniform mat4 u_viewProj;
+
+    void main() {
+        fragNormal = normal;
+        gl_Position = u_viewProj * vec4(position, 1.0);
+    }
+)";
+
+const char* CLOTH_FRAGMENT_SHADER = R"(
+    #version 410 core
+
+    in vec3 fragNormal;
+    out vec4 fragColor;
+
+    void main() {
+        vec3 lightDir = normalize(vec3(0.4, 1.0, 0.3));
+        float diff = abs(dot(normalize(fragNormal), lightDir));
+        vec3 color = vec3(0.8, 0.35, 0.3);
+        fragColor = vec4((0.25 + 0.75 * diff) * color, 1.0);
+    }
+)";
+
+struct ClothVertex {
+    float position[3];
+    float normal[3];
+};
+
+GLuint compileStage(GLenum type, const char* source) {
+    GLuint shader = glCreateShader(type);
+    glShaderSource(shader, 1, &source, nullptr);
+    glCompileShader(shader);
+
+    GLint compiled = GL_FALSE;
+    glGetShaderiv(shader, GL_COMPILE_STATUS, &compiled);
+    if (compiled != GL_TRUE) {
+        char log[1024];
+        glGetShaderInfoLog(shader, sizeof(log), nullptr, log);
+        glDeleteShader(shader);
+        throw std::runtime_error(std::string("cloth shader compile failed: ") + log);
+    }
+    return shader;
+}
+
+GLuint createClothProgram() {
+    GLuint vs = compileStage(GL_VERTEX_SHADER, CLOTH_VERTEX_SHADER);
+    GLuint fs = compileStage(GL_FRAGMENT_SHADER, CLOTH_FRAGMENT_SHADER);
+    GLuint program = glCreateProgram();
+    glAttachShader(program, vs);
+    glAttachShader(program, fs);
+    glLinkProgram(program);
+    glDeleteShader(vs);
+    glDeleteShader(fs);
+
+    GLint linked = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &linked);
+    if (linked != GL_TRUE) {
+        glDeleteProgram(program);
+        throw std::runtime_error("cloth program link failed");
+    }
+    return program;
+}
+
+int main(int argc, char** argv) {
+    bench::Harness harness("DynamicGeometryBenchmark", bench::Options::Parse(argc, argv));
+    int side = harness.scale() * 32;
+
+    size_t vertex_count = static_cast<size_t>(side) * side;
+    std::unique_ptr<stream::RingBuffer> vertex_stream;
+    GLuint program = 0, vao = 0, index_buffer = 0;
+    GLint view_proj_location = -1;
+    GLsizei index_count = 0;
+    double time = 0.0;
+
+    auto on_init = [&](engene::EnGene& app) {
+        harness.beginSceneBuild();
+
+        program = createClothProgram();
+        view_proj_location = glGetUniformLocation(program, "u_viewProj");
+
+        // Two triangles per grid cell; only the vertices change afterwards
+        std::vector<GLuint> indices;
+        indices.reserve(6 * (side - 1) * (side - 1));
+        for (int z = 0; z < side - 1; z++) {
+            for (int x = 0; x < side - 1; x++) {
+                GLuint i = z * side + x;
+                indices.insert(indices.end(), {i, i + side, i + 1, i + 1, i + side, i + side + 1});
+            }
+        }
+        index_count = static_cast<GLsizei>(indices.size());
+
+        vertex_stream = std::make_unique<stream::RingBuffer>(
+            GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(vertex_count * sizeof(ClothVertex)));
+
+        glGenVertexArrays(1, &vao);
+        glBindVertexArray(vao);
+        glGenBuffers(1, &index_buffer);
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, index_buffer);
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(GLuint), indices.data(), GL_STATIC_DRAW);
+        glVertexAttribFormat(0, 3, GL_FLOAT, GL_FALSE, offsetof(ClothVertex, position));
+        glVertexAttribFormat(1, 3, GL_FLOAT, GL_FALSE, offsetof(ClothVertex, normal));
+        glVertexAttribBinding(0, 0);
+        glVertexAttribBinding(1, 0);
+        glEnableVertexAttribArray(0);
+        glEnableVertexAttribArray(1);
+        glBindVertexArray(0);
+
+        framebuffer::stack()->depth().setTest(true);
+        framebuffer::stack()->depth().setWrite(true);
+        framebuffer::stack()->depth().setFunction(framebuffer::DepthFunc::Less);
+        GL_CHECK("cloth setup");
+
+        harness.endSceneBuild();
+        std::cout << "[INIT] " << side << "x" << side << " cloth, "
+                  << vertex_stream->segmentSize() / 1024 << " KB streamed per frame" << std::endl;
+        harness.onInitialize();
+    };
+
+    auto on_update = [&](double dt) {
+        harness.beginUpdate();
+        time += dt;
+        float t = static_cast<float>(time);
+
+        // Two crossing waves; normals from the analytic partial derivatives
+        const float K = 0.6f;
+        float step = CLOTH_SIZE / (side - 1);
+        auto* vertices = static_cast<ClothVertex*>(vertex_stream->data());
+        for (int z = 0; z < side; z++) {
+            for (int x = 0; x < side; x++) {
+                float px = x * step - CLOTH_SIZE * 0.5f;
+                float pz = z * step - CLOTH_SIZE * 0.5f;
+                float a = K * px + 2.0f * t;
+                float b = 0.7f * K * pz + 1.6f * t;
+                float y = WAVE_HEIGHT * std::sin(a) * std::cos(b);
+                float dydx = WAVE_HEIGHT * K * std::cos(a) * std::cos(b);
+                float dydz = -WAVE_HEIGHT * 0.7f * K * std::sin(a) * std::sin(b);
+                float inv_length = 1.0f / std::sqrt(dydx * dydx + 1.0f + dydz * dydz);
+
+                ClothVertex& v = vertices[z * side + x];
+                v.position[0] = px;
+                v.position[1] = y;
+                v.position[2] = pz;
+                v.normal[0] = -dydx * inv_length;
+                v.normal[1] = inv_length;
+                v.normal[2] = -dydz * inv_length;
+            }
+        }
+        vertex_stream->flush(0, vertex_stream->segmentSize());
+        harness.endUpdate();
+    };
+
+    auto on_render = [&](double alpha) {
+        harness.onFrame();
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+        if (!vertex_stream->upload()) {
+            throw std::runtime_error("Failed to map the cloth vertex segment");
+        }
+
+        glm::mat4 view_proj =
+            glm::perspective(glm::radians(60.0f), 1280.0f / 720.0f, 0.1f, 200.0f) *
+            glm::lookAt(glm::vec3(0.0f, CLOTH_SIZE * 0.6f, CLOTH_SIZE * 0.9f),
+                        glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+
+        // Restore what the engine had bound so its own state tracking stays valid
+        GLint previous_program = 0, previous_vao = 0;
+        glGetIntegerv(GL_CURRENT_PROGRAM, &previous_program);
+        glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &previous_vao);
+
+        glUseProgram(program);
+        glUniformMatrix4fv(view_proj_location, 1, GL_FALSE, &view_proj[0][0]);
+        glBindVertexArray(vao);
+        glBindVertexBuffer(0, vertex_stream->id(), vertex_stream->offset(), sizeof(ClothVertex));
+        glDrawElements(GL_TRIANGLES, index_count, GL_UNSIGNED_INT, nullptr);
+        vertex_stream->fence();
+
+        glBindVertexArray(previous_vao);
+        glUseProgram(previous_program);
+        GL_CHECK("render");
+        harness.endFrame();
+    };
+
+    engene::EnGeneConfig config;
+    config.title = "Dynamic Geometry Benchmark";
+    config.width = 1280;
+    config.height = 720;
+    config.clearColor[0] = 0.1f;
+    config.clearColor[1] = 0.1f;
+    config.clearColor[2] = 0.15f;
+    config.clearColor[3] = 1.0f;
+
+    try {
+        harness.prepareWindow();
+        engene::EnGene app(on_init, on_update, on_render, config);
+        app.run();
+
+        // Release GL objects while the context still exists
+        std::cout << "Streaming stalls: " << vertex_stream->stalls() << std::endl;
+        harness.setMetric("streaming_stalls", vertex_stream->stalls());
+        vertex_stream.reset();
+        glDeleteBuffers(1, &index_buffer);
+        glDeleteVertexArrays(1, &vao);
+        glDeleteProgram(program);
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Benchmark failed: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return harness.writeReport() ? 0 : 1;
+}
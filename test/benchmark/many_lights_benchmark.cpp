@@ -0,0 +1,238 @@
+#include <iostream>
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <string>
+#include <EnGene.h>
+#include <core/scene_node_builder.h>
+#include <components/all.h>
+#include <gl_base/error.h>
+#include <gl_base/material.h>
+#include <3d/camera/perspective_camera.h>
+#include <3d/lights/directional_light.h>
+#include <3d/lights/point_light.h>
+#include <other_genes/3d_shapes/cube.h>
+#include <other_genes/3d_shapes/sphere.h>
+#include "benchmark_harness.h"
+#include "../common/fog_shader.h"
+
+/**
+ * @brief Many-lights benchmark: fixed geometry, point-light count set by --scale.
+ *
+ * A floor and a FIELD_SIZE x FIELD_SIZE grid of spheres are lit by one
+ * directional light and --scale short-range point lights spread over the
+ * field, using ClipPlaneFogTest's lit fog shader. Geometry and draw count
+ * stay constant, so comparing runs at --scale 4, 8, 16, ... isolates the
+ * per-fragment light loop: every fragment evaluates every light, even
+ * though each point light only reaches a few spheres.
+ *
+ * The light::manager() SceneLights block has a fixed capacity. It is read
+ * back from the program bound by the first frame's draw (every node uses
+ * the lit shader) and the report's metrics record point_lights_requested, point_light_capacity and
+ * point_lights_rendered (the smaller of the two), so runs past the capacity
+ * are not mistaken for runs with more lights. Compare runs by
+ * point_lights_rendered, not --scale.
+ *
+ * Workload:
+ * - Shading cost linear in point-light count
+ * - FIELD_SIZE^2 + 1 draws, one shader and material
+ *
+ * Loads ClipPlaneFogTest's shaders through harness.corePath().
+ *
+ * Usage: ManyLightsBenchmark [--frames N] [--warmup N] [--scale N] [--out FILE] [--visible]
+ */
+
+const int FIELD_SIZE = 16;
+const float SPHERE_SPACING = 2.0f;
+
+/**
+ * @brief Point-light array length of @p program's SceneLights block, or 0 if it has none.
+ *
+ * The block layout belongs to the engine's shaders, so the capacity is asked
+ * from GL rather than assumed. Which member is the point-light array is a
+ * heuristic: members are matched as "<array>[i]..." whose array name
+ * contains "point" (case-insensitive), and the largest index + size wins.
+ * Arrays of structs report one active uniform per element
+ * ("pointLights[7].position"), arrays of scalars one per array
+ * ("pointLightRanges[0]" with size N), and index + size covers both.
+ */
+int pointLightCapacity(GLuint program) {
+    if (!program) return 0;
+    GLuint block = glGetUniformBlockIndex(program, "SceneLights");
+    if (block == GL_INVALID_INDEX) return 0;
+
+    GLint uniform_count = 0;
+    glGetProgramiv(program, GL_ACTIVE_UNIFORMS, &uniform_count);
+    int capacity = 0;
+    for (GLuint i = 0; i < static_cast<GLuint>(uniform_count); i++) {
+        GLint block_index = -1, size = 0;
+        glGetActiveUniformsiv(program, 1, &i, GL_UNIFORM_BLOCK_INDEX, &block_index);
+        glGetActiveUniformsiv(program, 1, &i, GL_UNIFORM_SIZE, &size);
+        if (block_index != static_cast<GLint>(block)) continue;
+
+        char name_buffer[256];
+        glGetActiveUniformName(program, i, sizeof(name_buffer), nullptr, name_buffer);
+        std::string name(name_buffer);
+        std::transform(name.begin(), name.end(), name.begin(),
+                       [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        // Block members may be reported with the block name in front
+        size_t member_start = name.rfind('.', name.find('['));
+        member_start = (member_start == std::string::npos) ? 0 : member_start + 1;
+        size_t bracket = name.find('[');
+        if (bracket == std::string::npos || name.find("point", member_start) >= bracket) continue;
+        int index = std::atoi(name.c_str() + bracket + 1);
+        capacity = std::max(capacity, index + size);
+    }
+    return capacity;
+}
+
+/// Records requested, capacity and rendered point-light counts for the report.
+void reportLightCounts(bench::Harness& harness, int light_count, GLuint program) {
+    int capacity = pointLightCapacity(program);
+    harness.setMetric("point_lights_requested", light_count);
+    if (capacity == 0) {
+        std::cerr << "[WARN] SceneLights point-light capacity not found in the bound program; "
+                  << "point_lights_rendered not reported" << std::endl;
+        return;
+    }
+    int rendered = std::min(light_count, capacity);
+    harness.setMetric("point_light_capacity", capacity);
+    harness.setMetric("point_lights_rendered", rendered);
+    if (rendered < light_count) {
+        std::cerr << "[WARN] SceneLights holds " << capacity << " point lights; "
+                  << light_count - rendered << " of --scale " << light_count
+                  << " are not rendered" << std::endl;
+    }
+}
+
+int main(int argc, char** argv) {
+    bench::Harness harness("ManyLightsBenchmark", bench::Options::Parse(argc, argv));
+    int light_count = harness.scale();
+
+    shader::ShaderPtr lit_shader;
+
+    auto on_init = [&](engene::EnGene& app) {
+        harness.beginSceneBuild();
+
+        float half_extent = (FIELD_SIZE - 1) * SPHERE_SPACING * 0.5f;
+
+        // Lights first so the SceneLights UBO exists when the shader is baked
+        light::DirectionalLightParams dir_params;
+        dir_params.base_direction = glm::vec3(-0.5f, -1.0f, -0.3f);
+        dir_params.ambient = glm::vec4(0.1f, 0.1f, 0.12f, 1.0f);
+        dir_params.diffuse = glm::vec4(0.2f, 0.2f, 0.25f, 1.0f);
+        dir_params.specular = glm::vec4(0.1f, 0.1f, 0.1f, 1.0f);
+        scene::graph()->addNode("dir_light")
+            .with<component::LightComponent>(
+                light::DirectionalLight::Make(dir_params), transform::Transform::Make());
+
+        // Point lights on a golden-angle spiral over the field, cycling through hues
+        const float GOLDEN_ANGLE = 2.39996323f;
+        for (int i = 0; i < light_count; i++) {
+            float radius = half_extent * std::sqrt((i + 0.5f) / light_count);
+            float angle = i * GOLDEN_ANGLE;
+
+            light::PointLightParams point_params;
+            point_params.position = glm::vec4(radius * std::cos(angle), 1.5f, radius * std::sin(angle), 1.0f);
+            point_params.ambient = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+            point_params.diffuse = glm::vec4(
+                0.5f + 0.5f * std::cos(angle),
+                0.5f + 0.5f * std::cos(angle + 2.094f),
+                0.5f + 0.5f * std::cos(angle + 4.189f), 1.0f);
+            point_params.specular = glm::vec4(0.5f, 0.5f, 0.5f, 1.0f);
+            point_params.constant = 1.0f;
+            point_params.linear = 0.35f;
+            point_params.quadratic = 0.44f;
+            scene::graph()->addNode("point_light" + std::to_string(i + 1))
+                .with<component::LightComponent>(
+                    light::PointLight::Make(point_params), transform::Transform::Make());
+        }
+
+        // Texture flags compiled in rather than uploaded, as in ClipPlaneFogTest
+        auto lit_variants = fogshader::makeVariants(
+            harness.corePath("core_gene/shaders/clip_plane_vertex.glsl"),
+            harness.corePath("core_gene/shaders/fragment_fog.glsl"),
+            glm::vec3(0.05f, 0.05f, 0.08f), 0.01f);
+        lit_shader = lit_variants.get<variants::mask<>>();
+
+        auto sphere_geom = Sphere::Make(0.6f, 16, 32);
+        auto floor_geom = Cube::Make(FIELD_SIZE * SPHERE_SPACING, 0.2f, FIELD_SIZE * SPHERE_SPACING);
+
+        auto base_material = material::Material::Make(glm::vec3(0.8f, 0.8f, 0.8f));
+        base_material->setShininess(32.0f);
+
+        auto& field = scene::graph()->addNode("lit_field")
+            .with<component::ShaderComponent>(lit_shader)
+            .with<component::MaterialComponent>(base_material);
+
+        field.addNode("floor")
+            .with<component::TransformComponent>(
+                transform::Transform::Make()->translate(0.0f, -0.7f, 0.0f))
+            .addComponent(component::ClipPlaneComponent::Make("clip_planes", "num_clip_planes"))
+            .addComponent(component::GeometryComponent::Make(floor_geom));
+
+        for (int x = 0; x < FIELD_SIZE; x++) {
+            for (int z = 0; z < FIELD_SIZE; z++) {
+                field.addNode("sphere_" + std::to_string(x) + "_" + std::to_string(z))
+                    .with<component::TransformComponent>(
+                        transform::Transform::Make()->translate(
+                            x * SPHERE_SPACING - half_extent, 0.0f, z * SPHERE_SPACING - half_extent))
+                    .addComponent(component::ClipPlaneComponent::Make("clip_planes", "num_clip_planes"))
+                    .addComponent(component::GeometryComponent::Make(sphere_geom));
+            }
+        }
+
+        auto camera = component::PerspectiveCamera::Make(60.0f, 0.1f, 200.0f);
+        camera->getTransform()->setTranslate(0.0f, half_extent * 1.2f, half_extent * 1.6f);
+        scene::graph()->setActiveCamera(camera);
+
+        light::manager().apply();
+
+        harness.endSceneBuild();
+        std::cout << "[INIT] " << light_count << " point lights over "
+                  << FIELD_SIZE * FIELD_SIZE << " spheres" << std::endl;
+        harness.onInitialize();
+    };
+
+    auto on_update = [](double dt) {
+        // Static scene; lights and camera do not move
+    };
+
+    bool light_counts_reported = false;
+    auto on_render = [&](double alpha) {
+        harness.onFrame();
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        scene::graph()->draw();
+        GL_CHECK("render");
+        harness.endFrame();
+
+        // Every node draws with lit_shader, so it is still bound; queried once, outside the timed frame
+        if (!light_counts_reported) {
+            GLint program = 0;
+            glGetIntegerv(GL_CURRENT_PROGRAM, &program);
+            reportLightCounts(harness, light_count, static_cast<GLuint>(program));
+            light_counts_reported = true;
+        }
+    };
+
+    engene::EnGeneConfig config;
+    config.title = "Many Lights Benchmark";
+    config.width = 1280;
+    config.height = 720;
+    config.clearColor[0] = 0.05f;
+    config.clearColor[1] = 0.05f;
+    config.clearColor[2] = 0.08f;
+    config.clearColor[3] = 1.0f;
+
+    try {
+        harness.prepareWindow();
+        engene::EnGene app(on_init, on_update, on_render, config);
+        app.run();
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Benchmark failed: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return harness.writeReport() ? 0 : 1;
+}
@@ -0,0 +1,108 @@
+#include <iostream>
+#include <vector>
+#include <EnGene.h>
+#include <core/scene_node_builder.h>
+#include <components/all.h>
+#include <gl_base/error.h>
+#include <gl_base/material.h>
+#include <3d/camera/perspective_camera.h>
+#include <other_genes/3d_shapes/cube.h>
+#include <other_genes/3d_shapes/sphere.h>
+#include "benchmark_harness.h"
+
+/**
+ * @brief Mixed-mesh benchmark: many distinct geometries, one shader and material.
+ *
+ * MESH_VARIANTS different meshes (cubes of different proportions and spheres
+ * of different tessellation) are assigned round-robin over a
+ * (scale * 4) x (scale * 4) grid, so consecutive draws almost never share a
+ * Geometry. Shader and material stay constant, which isolates the
+ * per-geometry cost (one VAO bind per draw) that a shared vertex/index
+ * buffer with multi-draw-indirect submission would remove.
+ *
+ * Workload:
+ * - One glBindVertexArray per draw (see per_frame.vertex_array_binds)
+ * - Small draws with few triangles each
+ *
+ * Usage: MixedMeshBenchmark [--frames N] [--warmup N] [--scale N] [--out FILE] [--visible]
+ */
+
+const int MESH_VARIANTS = 16;
+const float GRID_SPACING = 1.5f;
+
+int main(int argc, char** argv) {
+    bench::Harness harness("MixedMeshBenchmark", bench::Options::Parse(argc, argv));
+    int grid_size = harness.scale() * 4;
+
+    auto on_init = [&](engene::EnGene& app) {
+        harness.beginSceneBuild();
+
+        std::vector<geometry::GeometryPtr> meshes;
+        for (int i = 0; i < MESH_VARIANTS / 2; i++) {
+            float stretch = 0.5f + 0.1f * i;
+            meshes.push_back(Cube::Make(stretch, 1.0f, 1.5f - 0.1f * i));
+            meshes.push_back(Sphere::Make(0.5f, 6 + 2 * i, 12 + 4 * i));
+        }
+
+        auto material = material::Material::Make(glm::vec3(0.6f, 0.6f, 0.7f));
+        auto& group = scene::graph()->addNode("meshes")
+            .with<component::MaterialComponent>(material);
+
+        float half_extent = (grid_size - 1) * GRID_SPACING * 0.5f;
+        for (int x = 0; x < grid_size; x++) {
+            for (int z = 0; z < grid_size; z++) {
+                group.addNode("mesh_" + std::to_string(x) + "_" + std::to_string(z))
+                    .with<component::TransformComponent>(
+                        transform::Transform::Make()->setTranslate(
+                            x * GRID_SPACING - half_extent, 0.0f, z * GRID_SPACING - half_extent))
+                    .with<component::GeometryComponent>(meshes[(x * grid_size + z) % meshes.size()]);
+            }
+        }
+
+        auto camera = component::PerspectiveCamera::Make(60.0f, 0.1f, 500.0f);
+        camera->getTransform()->setTranslate(0.0f, half_extent, half_extent * 1.5f);
+        scene::graph()->setActiveCamera(camera);
+
+        auto base_shader = app.getBaseShader();
+        scene::graph()->getActiveCamera()->bindToShader(base_shader);
+        material::stack()->configureShaderDefaults(base_shader);
+        base_shader->Bake();
+
+        harness.endSceneBuild();
+        std::cout << "[INIT] " << grid_size * grid_size << " nodes over "
+                  << meshes.size() << " distinct meshes" << std::endl;
+        harness.onInitialize();
+    };
+
+    auto on_update = [](double dt) {
+        // Static scene; the camera does not move
+    };
+
+    auto on_render = [&](double alpha) {
+        harness.onFrame();
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        scene::graph()->draw();
+        GL_CHECK("render");
+        harness.endFrame();
+    };
+
+    engene::EnGeneConfig config;
+    config.title = "Mixed Mesh Benchmark";
+    config.width = 1280;
+    config.height = 720;
+    config.clearColor[0] = 0.1f;
+    config.clearColor[1] = 0.1f;
+    config.clearColor[2] = 0.15f;
+    config.clearColor[3] = 1.0f;
+
+    try {
+        harness.prepareWindow();
+        engene::EnGene app(on_init, on_update, on_render, config);
+        app.run();
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Benchmark failed: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return harness.writeReport() ? 0 : 1;
+}
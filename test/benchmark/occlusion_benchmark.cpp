@@ -0,0 +1,127 @@
+#include <iostream>
+#include <EnGene.h>
+#include <core/scene_node_builder.h>
+#include <components/all.h>
+#include <gl_base/error.h>
+#include <gl_base/framebuffer.h>
+#include <gl_base/material.h>
+#include <3d/camera/perspective_camera.h>
+#include <other_genes/3d_shapes/cube.h>
+#include <other_genes/3d_shapes/sphere.h>
+#include "benchmark_harness.h"
+
+/**
+ * @brief Occlusion benchmark: dense geometry hidden behind a few large occluders.
+ *
+ * A street-level camera looks down a row of OCCLUDER_COUNT building-sized
+ * boxes. Behind them, mostly inside the view frustum but hidden from it,
+ * sits a (scale * 4) x (scale * 4) grid of tessellated spheres. Frustum
+ * culling keeps most spheres, so nearly all of the submitted triangles and
+ * draws produce no visible pixel: the case that a Hi-Z occlusion pass over
+ * the previous frame's depth would remove.
+ *
+ * Occluders are added first, so with depth testing the hidden spheres cost
+ * vertex work and early-Z rejected fragments rather than full shading.
+ *
+ * Workload:
+ * - (scale * 4)^2 hidden sphere draws (Sphere 16 x 32)
+ * - OCCLUDER_COUNT large visible boxes
+ *
+ * Usage: OcclusionBenchmark [--frames N] [--warmup N] [--scale N] [--out FILE] [--visible]
+ */
+
+const int OCCLUDER_COUNT = 5;
+const float OCCLUDER_WIDTH = 14.0f;
+const float OCCLUDER_HEIGHT = 30.0f;
+const float HIDDEN_SPACING = 2.5f;
+
+int main(int argc, char** argv) {
+    bench::Harness harness("OcclusionBenchmark", bench::Options::Parse(argc, argv));
+    int grid_size = harness.scale() * 4;
+
+    auto on_init = [&](engene::EnGene& app) {
+        harness.beginSceneBuild();
+
+        auto box_geom = Cube::Make(1.0f, 1.0f, 1.0f);
+        auto sphere_geom = Sphere::Make(0.8f, 16, 32);
+
+        // Row of abutting buildings filling the view at z = -10
+        auto occluder_material = material::Material::Make(glm::vec3(0.5f, 0.5f, 0.55f));
+        auto& occluders = scene::graph()->addNode("occluders")
+            .with<component::MaterialComponent>(occluder_material);
+        float row_start = -(OCCLUDER_COUNT - 1) * OCCLUDER_WIDTH * 0.5f;
+        for (int i = 0; i < OCCLUDER_COUNT; i++) {
+            occluders.addNode("building_" + std::to_string(i))
+                .with<component::TransformComponent>(
+                    transform::Transform::Make()
+                        ->setTranslate(row_start + i * OCCLUDER_WIDTH, OCCLUDER_HEIGHT * 0.5f - 1.0f, -10.0f)
+                        ->scale(OCCLUDER_WIDTH, OCCLUDER_HEIGHT, 2.0f))
+                .with<component::GeometryComponent>(box_geom);
+        }
+
+        // Hidden grid behind the buildings
+        auto hidden_material = material::Material::Make(glm::vec3(0.8f, 0.3f, 0.3f));
+        auto& hidden = scene::graph()->addNode("hidden")
+            .with<component::MaterialComponent>(hidden_material);
+        float half_extent = (grid_size - 1) * HIDDEN_SPACING * 0.5f;
+        for (int x = 0; x < grid_size; x++) {
+            for (int z = 0; z < grid_size; z++) {
+                hidden.addNode("hidden_" + std::to_string(x) + "_" + std::to_string(z))
+                    .with<component::TransformComponent>(
+                        transform::Transform::Make()->setTranslate(
+                            x * HIDDEN_SPACING - half_extent, 0.0f, -15.0f - z * HIDDEN_SPACING))
+                    .with<component::GeometryComponent>(sphere_geom);
+            }
+        }
+
+        auto camera = component::PerspectiveCamera::Make(60.0f, 0.1f, 500.0f);
+        camera->getTransform()->setTranslate(0.0f, 1.7f, 10.0f);
+        scene::graph()->setActiveCamera(camera);
+
+        framebuffer::stack()->depth().setTest(true);
+        framebuffer::stack()->depth().setWrite(true);
+        framebuffer::stack()->depth().setFunction(framebuffer::DepthFunc::Less);
+
+        auto base_shader = app.getBaseShader();
+        scene::graph()->getActiveCamera()->bindToShader(base_shader);
+        material::stack()->configureShaderDefaults(base_shader);
+        base_shader->Bake();
+
+        harness.endSceneBuild();
+        std::cout << "[INIT] " << grid_size * grid_size << " hidden spheres behind "
+                  << OCCLUDER_COUNT << " occluders" << std::endl;
+        harness.onInitialize();
+    };
+
+    auto on_update = [](double dt) {
+        // Static scene; the camera does not move
+    };
+
+    auto on_render = [&](double alpha) {
+        harness.onFrame();
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        scene::graph()->draw();
+        GL_CHECK("render");
+        harness.endFrame();
+    };
+
+    engene::EnGeneConfig config;
+    config.title = "Occlusion Benchmark";
+    config.width = 1280;
+    config.height = 720;
+    config.clearColor[0] = 0.1f;
+    config.clearColor[1] = 0.1f;
+    config.clearColor[2] = 0.15f;
+    config.clearColor[3] = 1.0f;
+
+    try {
+        harness.prepareWindow();
+        engene::EnGene app(on_init, on_update, on_render, config);
+        app.run();
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Benchmark failed: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return harness.writeReport() ? 0 : 1;
+}
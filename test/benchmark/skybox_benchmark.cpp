@@ -0,0 +1,133 @@
+#include <iostream>
+#include <vector>
+#include <EnGene.h>
+#include <core/scene_node_builder.h>
+#include <components/all.h>
+#include <gl_base/cubemap.h>
+#include <gl_base/error.h>
+#include <3d/camera/perspective_camera.h>
+#include <other_genes/environment_mapping.h>
+#include <other_genes/3d_shapes/sphere.h>
+#include "benchmark_harness.h"
+
+/**
+ * @brief Benchmark version of SkyboxTest's scene.
+ *
+ * A skybox plus scale x scale environment-mapped spheres, cycling through
+ * SkyboxTest's four mappings (reflection, refraction, fresnel, chromatic
+ * dispersion) so neighbouring nodes switch shader.
+ *
+ * Workload:
+ * - Shader switches between interleaved mapping programs
+ * - Repeated cubemap binds through CubemapComponent
+ * - Skybox pass behind dense geometry
+ *
+ * Loads test/materials/skytest.png through harness.assetPath().
+ *
+ * Usage: SkyboxBenchmark [--frames N] [--warmup N] [--scale N] [--out FILE] [--visible]
+ */
+
+const float SPHERE_SPACING = 2.5f;
+
+int main(int argc, char** argv) {
+    bench::Harness harness("SkyboxBenchmark", bench::Options::Parse(argc, argv));
+    int scale = harness.scale();
+
+    texture::CubemapPtr cubemap;
+    std::vector<std::shared_ptr<environment::EnvironmentMapping>> env_mappings;
+
+    auto on_init = [&](engene::EnGene& app) {
+        harness.beginSceneBuild();
+
+        cubemap = texture::Cubemap::Make(harness.assetPath("test/materials/skytest.png"));
+
+        // Same four configurations as SkyboxTest
+        environment::EnvironmentMappingConfig reflection;
+        reflection.cubemap = cubemap;
+        reflection.mode = environment::MappingMode::REFLECTION;
+        reflection.reflection_coefficient = 0.6f;
+        reflection.base_color = glm::vec3(0.8f, 0.2f, 0.2f);
+
+        environment::EnvironmentMappingConfig refraction;
+        refraction.cubemap = cubemap;
+        refraction.mode = environment::MappingMode::REFRACTION;
+        refraction.index_of_refraction = 1.52f;
+        refraction.base_color = glm::vec3(0.2f, 0.8f, 0.2f);
+
+        environment::EnvironmentMappingConfig fresnel;
+        fresnel.cubemap = cubemap;
+        fresnel.mode = environment::MappingMode::FRESNEL;
+        fresnel.fresnel_power = 2.0f;
+        fresnel.index_of_refraction = 1.33f;
+        fresnel.base_color = glm::vec3(0.2f, 0.2f, 0.8f);
+
+        environment::EnvironmentMappingConfig dispersion;
+        dispersion.cubemap = cubemap;
+        dispersion.mode = environment::MappingMode::CHROMATIC_DISPERSION;
+        dispersion.ior_rgb = glm::vec3(1.20f, 1.52f, 1.74f);
+        dispersion.base_color = glm::vec3(0.8f, 0.8f, 0.2f);
+
+        for (const auto& mapping_config : {reflection, refraction, fresnel, dispersion}) {
+            env_mappings.push_back(std::make_shared<environment::EnvironmentMapping>(mapping_config));
+        }
+
+        scene::graph()->addNode("skybox")
+            .with<component::SkyboxComponent>(cubemap);
+
+        auto sphere_geom = Sphere::Make(1.0f, 16, 32);
+
+        float half_extent = (scale - 1) * SPHERE_SPACING * 0.5f;
+        for (int x = 0; x < scale; x++) {
+            for (int y = 0; y < scale; y++) {
+                const auto& mapping = env_mappings[(x + y) % env_mappings.size()];
+                scene::graph()->addNode("sphere_" + std::to_string(x) + "_" + std::to_string(y))
+                    .with<component::TransformComponent>(
+                        transform::Transform::Make()->setTranslate(
+                            x * SPHERE_SPACING - half_extent, y * SPHERE_SPACING - half_extent, 0.0f))
+                    .with<component::CubemapComponent>(cubemap, "environmentMap", 0)
+                    .with<component::ShaderComponent>(mapping->getShader())
+                    .with<component::GeometryComponent>(sphere_geom);
+            }
+        }
+
+        auto camera = component::PerspectiveCamera::Make(60.0f, 0.1f, 100.0f);
+        camera->getTransform()->setTranslate(0.0f, 0.0f, half_extent * 2.0f + 4.0f);
+        scene::graph()->setActiveCamera(camera);
+
+        harness.endSceneBuild();
+        std::cout << "[INIT] " << scale * scale << " environment-mapped spheres" << std::endl;
+        harness.onInitialize();
+    };
+
+    auto on_update = [](double dt) {
+        // Static scene; the camera does not move
+    };
+
+    auto on_render = [&](double alpha) {
+        harness.onFrame();
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        scene::graph()->draw();
+        GL_CHECK("render");
+        harness.endFrame();
+    };
+
+    engene::EnGeneConfig config;
+    config.title = "Skybox Benchmark";
+    config.width = 1024;
+    config.height = 768;
+    config.clearColor[0] = 0.1f;
+    config.clearColor[1] = 0.1f;
+    config.clearColor[2] = 0.15f;
+    config.clearColor[3] = 1.0f;
+
+    try {
+        harness.prepareWindow();
+        engene::EnGene app(on_init, on_update, on_render, config);
+        app.run();
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Benchmark failed: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return harness.writeReport() ? 0 : 1;
+}
@@ -0,0 +1,145 @@
+#include <iostream>
+#include <cmath>
+#include <vector>
+#include <EnGene.h>
+#include <core/scene_node_builder.h>
+#include <components/all.h>
+#include <gl_base/error.h>
+#include <gl_base/material.h>
+#include <gl_base/transform.h>
+#include <3d/camera/perspective_camera.h>
+#include <other_genes/3d_shapes/cube.h>
+#include "benchmark_harness.h"
+
+/**
+ * @brief Subtree update benchmark: many independent hierarchies, all moving.
+ *
+ * scale x scale small hierarchies (a root with RING_DEPTH levels of
+ * RING_SIZE children, TransformHierarchyTest's layout at a smaller size)
+ * sit side by side under the scene root. Every root rotates every fixed
+ * step, so the world matrix of every node in every subtree has to be
+ * recomputed each frame. The subtrees share nothing but the material:
+ * this is the CPU-bound case that splitting transform propagation and
+ * draw-list building over worker threads would speed up.
+ *
+ * Workload:
+ * - scale^2 * (1 + 6 + 36) transform nodes re-propagated per frame
+ * - scale^2 * 36 small cube draws, one shared geometry and material
+ *
+ * Usage: SubtreeUpdateBenchmark [--frames N] [--warmup N] [--scale N] [--out FILE] [--visible]
+ */
+
+const int RING_DEPTH = 2;              // Levels below each subtree root
+const int RING_SIZE = 6;               // Children per node
+const float RING_RADIUS = 3.0f;        // Child distance in parent space
+const float RING_SCALE = 0.4f;         // Child scale relative to parent
+const float SUBTREE_SPACING = 8.0f;
+
+// Subtree roots, rotated directly by on_update
+std::vector<std::shared_ptr<transform::Transform>> g_roots;
+
+template <typename Builder>
+void buildRing(Builder& parent, const std::string& prefix, int depth,
+               const geometry::GeometryPtr& geom) {
+    const float PI = 3.14159265359f;
+
+    for (int i = 0; i < RING_SIZE; i++) {
+        float angle = 2.0f * PI * i / RING_SIZE;
+        std::string name = prefix + "_" + std::to_string(i);
+
+        auto& child = parent.addNode(name)
+            .template with<component::TransformComponent>(
+                transform::Transform::Make()
+                    ->translate(RING_RADIUS * std::cos(angle), 0.0f, RING_RADIUS * std::sin(angle))
+                    ->scale(RING_SCALE, RING_SCALE, RING_SCALE));
+
+        if (depth == 1) {
+            child.template with<component::GeometryComponent>(geom);
+        } else {
+            buildRing(child, name, depth - 1, geom);
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    bench::Harness harness("SubtreeUpdateBenchmark", bench::Options::Parse(argc, argv));
+    int scale = harness.scale();
+
+    auto on_init = [&](engene::EnGene& app) {
+        harness.beginSceneBuild();
+
+        auto cube_geom = Cube::Make(1.0f, 1.0f, 1.0f);
+        auto material = material::Material::Make(glm::vec3(0.8f, 0.6f, 0.3f));
+
+        auto& group = scene::graph()->addNode("subtrees")
+            .with<component::MaterialComponent>(material);
+
+        float half_extent = (scale - 1) * SUBTREE_SPACING * 0.5f;
+        for (int x = 0; x < scale; x++) {
+            for (int z = 0; z < scale; z++) {
+                std::string name = "subtree_" + std::to_string(x) + "_" + std::to_string(z);
+                auto root_transform = transform::Transform::Make();
+                root_transform->setTranslate(
+                    x * SUBTREE_SPACING - half_extent, 0.0f, z * SUBTREE_SPACING - half_extent);
+                g_roots.push_back(root_transform);
+
+                auto& root = group.addNode(name)
+                    .with<component::TransformComponent>(root_transform);
+                buildRing(root, name, RING_DEPTH, cube_geom);
+            }
+        }
+
+        auto camera = component::PerspectiveCamera::Make(60.0f, 0.1f, 500.0f);
+        camera->getTransform()->setTranslate(0.0f, half_extent * 1.2f + 6.0f, half_extent * 1.5f + 8.0f);
+        scene::graph()->setActiveCamera(camera);
+
+        auto base_shader = app.getBaseShader();
+        scene::graph()->getActiveCamera()->bindToShader(base_shader);
+        material::stack()->configureShaderDefaults(base_shader);
+        base_shader->Bake();
+
+        harness.endSceneBuild();
+        std::cout << "[INIT] " << g_roots.size() << " independent subtrees, "
+                  << g_roots.size() * static_cast<int>(std::pow(RING_SIZE, RING_DEPTH))
+                  << " leaf cubes" << std::endl;
+        harness.onInitialize();
+    };
+
+    auto on_update = [&](double dt) {
+        harness.beginUpdate();
+        // Alternate directions so neighbouring subtrees visibly move independently
+        for (size_t i = 0; i < g_roots.size(); i++) {
+            float speed = (i % 2 == 0) ? 30.0f : -30.0f;
+            g_roots[i]->rotate(speed * (float)dt, 0, 1, 0);
+        }
+        harness.endUpdate();
+    };
+
+    auto on_render = [&](double alpha) {
+        harness.onFrame();
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        scene::graph()->draw();
+        GL_CHECK("render");
+        harness.endFrame();
+    };
+
+    engene::EnGeneConfig config;
+    config.title = "Subtree Update Benchmark";
+    config.width = 1280;
+    config.height = 720;
+    config.clearColor[0] = 0.1f;
+    config.clearColor[1] = 0.1f;
+    config.clearColor[2] = 0.15f;
+    config.clearColor[3] = 1.0f;
+
+    try {
+        harness.prepareWindow();
+        engene::EnGene app(on_init, on_update, on_render, config);
+        app.run();
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Benchmark failed: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return harness.writeReport() ? 0 : 1;
+}
@@ -12,7 +12,7 @@
 #include <3d/lights/spot_light.h>
 #include <other_genes/3d_shapes/sphere.h>
 #include <other_genes/input_handlers/arcball_input_handler.h>
-#include <gl_base/uniforms/uniform.h>
+#include "../common/fog_shader.h"
 
 /**
  * @brief Comprehensive test for clip planes and fog with multiple lights.
@@ -23,6 +23,7 @@
  * - Multiple lights (directional, point, spot)
  * - Arcball camera controls
  * - Scene graph integration
+ * - Shader variant with the texture flags compiled in (variants::VariantSet)
  * 
  * Controls:
  * - Left Mouse Button + Drag: Rotate camera (orbit)
@@ -115,23 +116,24 @@ int main() {
         // Load custom shaders from files (AFTER lights are created so SceneLights UBO exists)
         try {
             
-            fog_shader = shader::Shader::Make(
-                "core_gene/shaders/clip_plane_vertex.glsl", 
-                "core_gene/shaders/fragment_fog.glsl"
-            );
+            // The texture flags are fixed per variant instead of uploaded as uniforms
+            auto fog_variants = fogshader::makeVariants(
+                "core_gene/shaders/clip_plane_vertex.glsl",
+                "core_gene/shaders/fragment_fog.glsl",
+                glm::vec3(0.5f, 0.6f, 0.7f), // Blueish fog
+                0.08f);                      // Moderate fog density
             
-            // Configure uniform blocks
-            fog_shader->addResourceBlockToBind("CameraMatrices");
-            fog_shader->addResourceBlockToBind("CameraPosition");
-            fog_shader->addResourceBlockToBind("SceneLights");
+            // No maps are bound anywhere in this test
+            fog_shader = fog_variants.get<variants::mask<>>();
             
-            // Configure dynamic uniforms
-            fog_shader->configureDynamicUniform<glm::mat4>("u_model", transform::current);
-            
-            // Configure material uniforms from material stack
-            material::stack()->configureShaderDefaults(fog_shader);
-            
-            fog_shader->Bake();
+            // A flag set must compile a second, distinct program; asking again must reuse it
+            auto& normal_mapped = fog_variants.get<variants::mask<fogshader::NORMAL_MAP>>();
+            if (fog_variants.get(fogshader::NORMAL_MAP) != normal_mapped ||
+                fog_variants.size() != 2 || normal_mapped == fog_shader) {
+                throw std::runtime_error("Expected 2 distinct shader variants, got " +
+                                         std::to_string(fog_variants.size()));
+            }
+            std::cout << "✓ " << fog_variants.size() << " shader variants compiled (no maps, normal map)" << std::endl;
             std::cout << "✓ Custom shader compiled and linked" << std::endl;
         } catch (const std::exception& e) {
             std::cerr << "✗ Shader compilation failed: " << e.what() << std::endl;
@@ -147,32 +149,20 @@ int main() {
         auto base_material = material::Material::Make(glm::vec3(0.8f, 0.8f, 0.8f));
         base_material->setShininess(64.0f);
         
-        // Create fog uniforms (these are scene-wide, not per-material)
-        auto fog_vars = component::VariableComponent::Make(
-            uniform::Uniform<glm::vec3>::Make("fogcolor", []() { 
-                return glm::vec3(0.5f, 0.6f, 0.7f); // Blueish fog
-            })
-        );
-        fog_vars->addUniform(uniform::Uniform<float>::Make("fogdensity", []() { 
-            return 0.08f; // Moderate fog density
-        }));
-        
-        // Texture flags (these are also scene-wide for this test)
-        fog_vars->addUniform(uniform::Uniform<bool>::Make("u_hasNormalMap", []() { return false; }));
-        fog_vars->addUniform(uniform::Uniform<bool>::Make("u_hasRoughnessMap", []() { return false; }));
-        fog_vars->addUniform(uniform::Uniform<bool>::Make("u_hasDiffuseMap", []() { return false; }));
+        // Shared state (shader, material) lives on one group node,
+        // so it is applied once for all spheres instead of once per sphere
+        auto& fog_group = scene::graph()->addNode("fog_spheres")
+            .with<component::ShaderComponent>(fog_shader)
+            .with<component::MaterialComponent>(base_material);
         
         // Center sphere with two clip planes
         auto center_clip = component::ClipPlaneComponent::Make("clip_planes", "num_clip_planes");
         center_clip->addPlane(1.0f, 0.0f, 0.0f, 0.0f);  // Cut along X axis
         center_clip->addPlane(0.0f, 1.0f, 0.0f, 0.0f);  // Cut along Y axis
         
-        scene::graph()->addNode("center_sphere")
+        fog_group.addNode("center_sphere")
             .with<component::TransformComponent>(
                 transform::Transform::Make()->translate(0.0f, 0.0f, 0.0f)->scale(2.0f, 2.0f, 2.0f))
-            .with<component::ShaderComponent>(fog_shader)
-            .with<component::MaterialComponent>(base_material)
-            .addComponent(fog_vars)
             .addComponent(center_clip)
             .addComponent(component::GeometryComponent::Make(sphere_geom));
         
@@ -180,12 +170,9 @@ int main() {
         auto left_clip = component::ClipPlaneComponent::Make("clip_planes", "num_clip_planes");
         left_clip->addPlane(0.0f, 0.0f, 1.0f, 0.0f);  // Cut along Z axis
         
-        scene::graph()->addNode("left_sphere")
+        fog_group.addNode("left_sphere")
             .with<component::TransformComponent>(
                 transform::Transform::Make()->translate(-4.0f, 0.0f, 0.0f)->scale(1.5f, 1.5f, 1.5f))
-            .with<component::ShaderComponent>(fog_shader)
-            .with<component::MaterialComponent>(base_material)
-            .addComponent(fog_vars)
             .addComponent(left_clip)
             .addComponent(component::GeometryComponent::Make(sphere_geom));
         
@@ -193,12 +180,9 @@ int main() {
         auto right_clip = component::ClipPlaneComponent::Make("clip_planes", "num_clip_planes");
         // Don't add any planes - will automatically set num_clip_planes = 0
         
-        scene::graph()->addNode("right_sphere")
+        fog_group.addNode("right_sphere")
             .with<component::TransformComponent>(
                 transform::Transform::Make()->translate(4.0f, 0.0f, 0.0f)->scale(1.5f, 1.5f, 1.5f))
-            .with<component::ShaderComponent>(fog_shader)
-            .with<component::MaterialComponent>(base_material)
-            .addComponent(fog_vars)
             .addComponent(right_clip)
             .addComponent(component::GeometryComponent::Make(sphere_geom));
         
@@ -209,12 +193,9 @@ int main() {
             // ClipPlaneComponent with no planes for distant spheres
             auto fog_clip = component::ClipPlaneComponent::Make("clip_planes", "num_clip_planes");
             
-            scene::graph()->addNode("fog_sphere_" + std::to_string(i))
+            fog_group.addNode("fog_sphere_" + std::to_string(i))
                 .with<component::TransformComponent>(
                     transform::Transform::Make()->translate(0.0f, 0.0f, z)->scale(1.0f, 1.0f, 1.0f))
-                .with<component::ShaderComponent>(fog_shader)
-                .with<component::MaterialComponent>(base_material)
-                .addComponent(fog_vars)
                 .addComponent(fog_clip)
                 .addComponent(component::GeometryComponent::Make(sphere_geom));
         }
@@ -16,6 +16,7 @@
 #include <components/all.h>
 #include <3d/camera/perspective_camera.h>
 #include <gl_base/error.h>
+#include <gl_base/framebuffer.h>
 #include <gl_base/material.h>
 #include <other_genes/3d_shapes/cube.h>
 #include <other_genes/input_handlers/arcball_input_handler.h>
@@ -31,6 +32,7 @@ const char* CAMERA2_NAME = "Camera2";
 std::shared_ptr<arcball::ArcBallController> arcball1;
 std::shared_ptr<arcball::ArcBallController> arcball2;
 std::shared_ptr<arcball::ArcBallController> activeArcball;
+bool camera1Active = true;
 
 // Input handler for camera switching with ArcBall integration
 class CameraSwitchHandler : public input::InputHandler {
@@ -38,10 +40,8 @@ protected:
     void handleKey(GLFWwindow* window, int key, int scancode, int action, int mods) override {
         if (key == GLFW_KEY_C && action == GLFW_PRESS) {
             // Toggle between cameras
-            auto currentCamera = scene::graph()->getActiveCamera();
-            if (currentCamera) {
-                auto currentNode = scene::graph()->getNodeByName(CAMERA1_NAME);
-                if (currentNode && currentNode->payload().get<component::PerspectiveCamera>() == currentCamera) {
+            if (scene::graph()->getActiveCamera()) {
+                if (camera1Active) {
                     // Switch to camera 2
                     scene::graph()->setActiveCamera(CAMERA2_NAME);
                     activeArcball = arcball2;
@@ -52,6 +52,7 @@ protected:
                     activeArcball = arcball1;
                     std::cout << "Switched to Camera 1 (Side View)" << std::endl;
                 }
+                camera1Active = !camera1Active;
                 
                 // Sync the new active arcball with its camera
                 if (activeArcball) {
@@ -77,8 +78,8 @@ int main() {
         auto handler = std::make_shared<CameraSwitchHandler>();
         
         auto on_initialize = [&](engene::EnGene& app) {
-            glEnable(GL_DEPTH_TEST);
-            glClearColor(0.1f, 0.1f, 0.15f, 1.0f);
+            // Go through the framebuffer stack so its tracked state matches GL
+            framebuffer::stack()->depth().setTest(true);
             
             // Create Camera 1 - Side view position
             scene::graph()->addNode(CAMERA1_NAME)
@@ -119,15 +120,17 @@ int main() {
             
             // Create asymmetric scene with colored cubes using Cube class and Material system
             
+            // All cubes share one geometry; size comes from each node's transform
+            auto cube = Cube::Make();
+            
             // Helper lambda to create a cube with material
-            auto createCube = [&app](const std::string& name, const glm::vec3& position, 
-                                     const glm::vec3& scale, const glm::vec3& color) {
+            auto createCube = [&app, cube](const std::string& name, const glm::vec3& position, 
+                                           const glm::vec3& scale, const glm::vec3& color) {
                 auto transform = transform::Transform::Make();
                 transform->translate(position.x, position.y, position.z);
                 transform->scale(scale.x, scale.y, scale.z);
                 
                 auto material = material::Material::Make(color);
-                auto cube = Cube::Make();
                 
                 scene::graph()->addNode(name)
                     .with<component::TransformComponent>(transform)
@@ -195,6 +198,10 @@ int main() {
         config.title = "Dual Camera Test - Press 'C' to Switch";
         config.width = 800;
         config.height = 600;
+        config.clearColor[0] = 0.1f;
+        config.clearColor[1] = 0.1f;
+        config.clearColor[2] = 0.15f;
+        config.clearColor[3] = 1.0f;
         
         engene::EnGene app(on_initialize, on_fixed_update, on_render, config, handler.get());
         app.run();
@@ -2,6 +2,7 @@
 #include <core/scene_node_builder.h>
 #include <components/all.h>
 #include <gl_base/error.h>
+#include <gl_base/framebuffer.h>
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -68,9 +69,12 @@ int main() {
     // Create a platform InputHandler and an arcball handler placeholder
     auto* handler = new input::InputHandler();
     std::shared_ptr<arcball::ArcBallController> arcball_handler;
+    
+    // Rotating cube transform (created in on_initialize, animated in on_fixed_update)
+    std::shared_ptr<transform::Transform> cube_transform;
 
     auto on_initialize = [&](engene::EnGene& app) {
-        glEnable(GL_DEPTH_TEST);
+        framebuffer::stack()->depth().setTest(true);
         
         // Create shader by passing file paths
         auto projectiveShader = shader::Shader::Make(
@@ -159,7 +163,7 @@ int main() {
             .with<component::GeometryComponent>(plane);
         
         // Create rotating cube
-        auto cube_transform = transform::Transform::Make();
+        cube_transform = transform::Transform::Make();
         cube_transform->translate(0, 1, 0);
         
         scene::graph()->addNode("Cube")
@@ -185,14 +189,11 @@ int main() {
         std::cout << "✓ Arcball controller attached" << std::endl;
     };
     
-    auto on_fixed_update = [](double dt) {
+    auto on_fixed_update = [&](double dt) {
         // Rotate the cube
-        if (auto cube = scene::graph()->getNodeByName("Cube")) {
-            auto transform_component = cube->payload().get<component::TransformComponent>();
-            if (transform_component) {
-                transform_component->getTransform()->rotate(20.0f * (float)dt, 0, 1, 0);
-                transform_component->getTransform()->rotate(15.0f * (float)dt, 1, 0, 0);
-            }
+        if (cube_transform) {
+            cube_transform->rotate(20.0f * (float)dt, 0, 1, 0);
+            cube_transform->rotate(15.0f * (float)dt, 1, 0, 0);
         }
     };
     
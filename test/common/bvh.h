@@ -0,0 +1,249 @@
+#pragma once
+
+#include <EnGene.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+/**
+ * @brief Bounding volume hierarchy over axis-aligned boxes, for scene queries.
+ *
+ * The tree indexes boxes by their position in the vector passed to build();
+ * queries return those indices, so callers keep a parallel vector of nodes
+ * (or transforms) to map hits back to the scene. build() splits at the
+ * centroid median of the widest axis down to LEAF_SIZE boxes per leaf.
+ * refit() recomputes node bounds bottom-up after boxes move, keeping the
+ * topology, which is cheap enough to run every frame for animated content;
+ * rebuild when the boxes have moved far enough that queries slow down.
+ *
+ * Queries only read the tree, so any number of threads can run them
+ * concurrently between build()/refit() calls.
+ *
+ * Usage:
+ * @code
+ * bvh::Tree tree;
+ * tree.build(bounds);
+ * bvh::Hit hit = tree.raycast(origin, direction);
+ * if (hit.index >= 0) picked = nodes[hit.index];
+ * tree.querySphere(center, radius, nearby);
+ * @endcode
+ */
+namespace bvh {
+
+struct AABB {
+    glm::vec3 min = glm::vec3(std::numeric_limits<float>::max());
+    glm::vec3 max = glm::vec3(-std::numeric_limits<float>::max());
+
+    void expand(const AABB& other) {
+        min = glm::min(min, other.min);
+        max = glm::max(max, other.max);
+    }
+
+    glm::vec3 center() const { return (min + max) * 0.5f; }
+};
+
+/// Entry distance along the ray to @p box, or a negative value on a miss.
+/// @p inv_direction is 1 / direction per component (infinite for zeros).
+inline float intersectRay(const AABB& box, const glm::vec3& origin,
+                          const glm::vec3& inv_direction, float max_t) {
+    float t_min = 0.0f;
+    float t_max = max_t;
+    for (int axis = 0; axis < 3; axis++) {
+        float t0 = (box.min[axis] - origin[axis]) * inv_direction[axis];
+        float t1 = (box.max[axis] - origin[axis]) * inv_direction[axis];
+        if (t0 > t1) std::swap(t0, t1);
+        t_min = std::max(t_min, t0);
+        t_max = std::min(t_max, t1);
+        if (t_min > t_max) return -1.0f;
+    }
+    return t_min;
+}
+
+inline bool intersectSphere(const AABB& box, const glm::vec3& center, float radius) {
+    glm::vec3 closest = glm::clamp(center, box.min, box.max);
+    glm::vec3 offset = closest - center;
+    return glm::dot(offset, offset) <= radius * radius;
+}
+
+/// Planes are (normal, d) with normals pointing inwards, as from frustumPlanes().
+inline bool intersectFrustum(const AABB& box, const glm::vec4 planes[6]) {
+    for (int i = 0; i < 6; i++) {
+        // Corner furthest along the plane normal
+        glm::vec3 corner(planes[i].x >= 0.0f ? box.max.x : box.min.x,
+                         planes[i].y >= 0.0f ? box.max.y : box.min.y,
+                         planes[i].z >= 0.0f ? box.max.z : box.min.z);
+        if (glm::dot(glm::vec3(planes[i]), corner) + planes[i].w < 0.0f) return false;
+    }
+    return true;
+}
+
+/// Extracts the six clip planes of @p view_proj (Gribb-Hartmann), normalized.
+inline void frustumPlanes(const glm::mat4& view_proj, glm::vec4 planes[6]) {
+    glm::vec4 row[4];
+    for (int i = 0; i < 4; i++) {
+        row[i] = glm::vec4(view_proj[0][i], view_proj[1][i], view_proj[2][i], view_proj[3][i]);
+    }
+    planes[0] = row[3] + row[0];   // left
+    planes[1] = row[3] - row[0];   // right
+    planes[2] = row[3] + row[1];   // bottom
+    planes[3] = row[3] - row[1];   // top
+    planes[4] = row[3] + row[2];   // near
+    planes[5] = row[3] - row[2];   // far
+    for (int i = 0; i < 6; i++) {
+        planes[i] /= glm::length(glm::vec3(planes[i]));
+    }
+}
+
+struct Hit {
+    int index = -1;                                         // -1 on a miss
+    float distance = std::numeric_limits<float>::max();     // along the ray, in direction units
+};
+
+class Tree {
+public:
+    static constexpr int LEAF_SIZE = 4;
+
+    void build(const std::vector<AABB>& bounds) {
+        bounds_ = bounds;
+        nodes_.clear();
+        indices_.resize(bounds.size());
+        for (size_t i = 0; i < indices_.size(); i++) indices_[i] = static_cast<int>(i);
+        if (bounds.empty()) return;
+
+        nodes_.reserve(2 * bounds.size() / LEAF_SIZE + 1);
+        nodes_.emplace_back();
+        split(0, 0, static_cast<int>(indices_.size()));
+    }
+
+    /// Updates the boxes (same count and order as build()) and every node's bounds.
+    void refit(const std::vector<AABB>& bounds) {
+        bounds_ = bounds;
+        // Children are always stored after their parent, so a reverse sweep is bottom-up
+        for (int i = static_cast<int>(nodes_.size()) - 1; i >= 0; i--) {
+            Node& node = nodes_[i];
+            node.bounds = AABB();
+            if (node.count > 0) {
+                for (int j = node.first; j < node.first + node.count; j++) {
+                    node.bounds.expand(bounds_[indices_[j]]);
+                }
+            } else {
+                node.bounds.expand(nodes_[node.first].bounds);
+                node.bounds.expand(nodes_[node.first + 1].bounds);
+            }
+        }
+    }
+
+    /// Nearest box hit by the ray within @p max_distance.
+    Hit raycast(const glm::vec3& origin, const glm::vec3& direction,
+                float max_distance = std::numeric_limits<float>::max()) const {
+        Hit hit;
+        hit.distance = max_distance;
+        if (nodes_.empty()) return hit;
+
+        glm::vec3 inv_direction = 1.0f / direction;
+        int stack[64];
+        int top = 0;
+        stack[top++] = 0;
+        while (top > 0) {
+            const Node& node = nodes_[stack[--top]];
+            float t = intersectRay(node.bounds, origin, inv_direction, hit.distance);
+            if (t < 0.0f) continue;
+
+            if (node.count > 0) {
+                for (int j = node.first; j < node.first + node.count; j++) {
+                    float t_item = intersectRay(bounds_[indices_[j]], origin, inv_direction, hit.distance);
+                    if (t_item >= 0.0f && t_item < hit.distance) {
+                        hit.index = indices_[j];
+                        hit.distance = t_item;
+                    }
+                }
+            } else {
+                stack[top++] = node.first;
+                stack[top++] = node.first + 1;
+            }
+        }
+        return hit;
+    }
+
+    /// Appends the index of every box overlapping the sphere to @p out.
+    void querySphere(const glm::vec3& center, float radius, std::vector<int>& out) const {
+        query(out, [&](const AABB& box) { return intersectSphere(box, center, radius); });
+    }
+
+    /// Appends the index of every box at least partly inside the frustum to @p out.
+    void queryFrustum(const glm::vec4 planes[6], std::vector<int>& out) const {
+        query(out, [&](const AABB& box) { return intersectFrustum(box, planes); });
+    }
+
+    size_t nodeCount() const { return nodes_.size(); }
+
+private:
+    struct Node {
+        AABB bounds;
+        int first = 0;      // leaf: first slot in indices_; inner: left child (right is first + 1)
+        int count = 0;      // boxes in a leaf, 0 for inner nodes
+    };
+
+    void split(int node_index, int begin, int end) {
+        AABB bounds, centroids;
+        for (int i = begin; i < end; i++) {
+            const AABB& box = bounds_[indices_[i]];
+            bounds.expand(box);
+            glm::vec3 c = box.center();
+            centroids.expand(AABB{c, c});
+        }
+        nodes_[node_index].bounds = bounds;
+
+        if (end - begin <= LEAF_SIZE) {
+            nodes_[node_index].first = begin;
+            nodes_[node_index].count = end - begin;
+            return;
+        }
+
+        glm::vec3 extent = centroids.max - centroids.min;
+        int axis = 0;
+        if (extent.y > extent[axis]) axis = 1;
+        if (extent.z > extent[axis]) axis = 2;
+
+        int mid = begin + (end - begin) / 2;
+        std::nth_element(indices_.begin() + begin, indices_.begin() + mid, indices_.begin() + end,
+            [&](int a, int b) { return bounds_[a].center()[axis] < bounds_[b].center()[axis]; });
+
+        int left = static_cast<int>(nodes_.size());
+        nodes_.emplace_back();
+        nodes_.emplace_back();
+        nodes_[node_index].first = left;
+        nodes_[node_index].count = 0;
+        split(left, begin, mid);
+        split(left + 1, mid, end);
+    }
+
+    template <typename Overlaps>
+    void query(std::vector<int>& out, Overlaps overlaps) const {
+        if (nodes_.empty()) return;
+
+        int stack[64];
+        int top = 0;
+        stack[top++] = 0;
+        while (top > 0) {
+            const Node& node = nodes_[stack[--top]];
+            if (!overlaps(node.bounds)) continue;
+
+            if (node.count > 0) {
+                for (int j = node.first; j < node.first + node.count; j++) {
+                    if (overlaps(bounds_[indices_[j]])) out.push_back(indices_[j]);
+                }
+            } else {
+                stack[top++] = node.first;
+                stack[top++] = node.first + 1;
+            }
+        }
+    }
+
+    std::vector<AABB> bounds_;
+    std::vector<int> indices_;
+    std::vector<Node> nodes_;
+};
+
+} // namespace bvh
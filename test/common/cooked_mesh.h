@@ -0,0 +1,269 @@
+#pragma once
+
+#include <EnGene.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <initializer_list>
+#include <stdexcept>
+#include <string>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Pre-cooked binary meshes loaded through a memory mapping.
+ *
+ * A cooked mesh stores exactly what geometry::Geometry::Make takes:
+ * interleaved float vertices, 32-bit indices and the attribute layout
+ * (position size plus up to MAX_ATTRIBUTES extra attribute sizes), together
+ * with the position bounds. load() maps the file and hands pointers into the
+ * mapping to Geometry::Make, so vertex data goes from the page cache to the
+ * GL buffer without a parse step or an intermediate std::vector.
+ *
+ * File layout (native endianness, all offsets 4-byte aligned):
+ *   Header | vertices (vertex_count * stride floats) | indices (index_count uint32)
+ *
+ * Usage:
+ * @code
+ * cooked::write("mesh.cgm", vertices.data(), nverts, indices.data(), nidx, 3, {3, 2});
+ * geometry::GeometryPtr mesh = cooked::load("mesh.cgm");
+ * @endcode
+ */
+namespace cooked {
+
+constexpr char MAGIC[4] = {'C', 'G', 'M', 'B'};
+constexpr uint32_t VERSION = 1;
+constexpr uint32_t MAX_ATTRIBUTES = 4;
+constexpr uint32_t MAX_COMPONENTS = 4;         // floats per vertex attribute, as for glVertexAttribPointer
+
+struct Header {
+    char magic[4];
+    uint32_t version;
+    uint32_t vertex_count;
+    uint32_t index_count;
+    uint32_t position_size;                     // floats per position (2-4)
+    uint32_t attribute_count;
+    uint32_t attribute_sizes[MAX_ATTRIBUTES];   // floats per extra attribute (1-4)
+    float bounds_min[3];
+    float bounds_max[3];
+    uint32_t vertex_offset;                     // bytes from file start
+    uint32_t index_offset;
+
+    uint32_t stride() const {
+        uint32_t floats = position_size;
+        for (uint32_t i = 0; i < attribute_count; i++) floats += attribute_sizes[i];
+        return floats;
+    }
+};
+
+/**
+ * @brief Writes a cooked mesh. Bounds are computed from the first three position components.
+ * @return false if the layout is unsupported, an index is out of range or the
+ *         file could not be written.
+ */
+inline bool write(const std::string& path,
+                  const float* vertices, uint32_t vertex_count,
+                  const unsigned int* indices, uint32_t index_count,
+                  uint32_t position_size, std::initializer_list<uint32_t> attribute_sizes) {
+    if (position_size < 2 || position_size > MAX_COMPONENTS || attribute_sizes.size() > MAX_ATTRIBUTES) {
+        return false;
+    }
+    for (uint32_t size : attribute_sizes) {
+        if (size < 1 || size > MAX_COMPONENTS) return false;
+    }
+    for (uint32_t i = 0; i < index_count; i++) {
+        if (indices[i] >= vertex_count) return false;
+    }
+
+    Header header = {};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.vertex_count = vertex_count;
+    header.index_count = index_count;
+    header.position_size = position_size;
+    header.attribute_count = static_cast<uint32_t>(attribute_sizes.size());
+    uint32_t slot = 0;
+    for (uint32_t size : attribute_sizes) header.attribute_sizes[slot++] = size;
+
+    uint32_t stride = header.stride();
+    for (int axis = 0; axis < 3; axis++) {
+        header.bounds_min[axis] = vertex_count ? 3.4e38f : 0.0f;
+        header.bounds_max[axis] = vertex_count ? -3.4e38f : 0.0f;
+    }
+    for (uint32_t v = 0; v < vertex_count; v++) {
+        const float* position = vertices + static_cast<size_t>(v) * stride;
+        for (uint32_t axis = 0; axis < 3; axis++) {
+            float value = axis < position_size ? position[axis] : 0.0f;
+            if (value < header.bounds_min[axis]) header.bounds_min[axis] = value;
+            if (value > header.bounds_max[axis]) header.bounds_max[axis] = value;
+        }
+    }
+
+    // Offsets are 32-bit, so the vertex block must end below 4 GB
+    uint64_t vertex_bytes = static_cast<uint64_t>(vertex_count) * stride * sizeof(float);
+    if (sizeof(Header) + vertex_bytes > UINT32_MAX) return false;
+    header.vertex_offset = sizeof(Header);
+    header.index_offset = static_cast<uint32_t>(header.vertex_offset + vertex_bytes);
+
+    std::ofstream file(path, std::ios::binary);
+    if (!file.is_open()) return false;
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(vertices), static_cast<std::streamsize>(vertex_bytes));
+    file.write(reinterpret_cast<const char*>(indices), static_cast<size_t>(index_count) * sizeof(unsigned int));
+    return static_cast<bool>(file);
+}
+
+/**
+ * @brief Read-only memory mapping of a whole file.
+ */
+class MappedFile {
+public:
+    explicit MappedFile(const std::string& path) {
+#ifdef _WIN32
+        file_ = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                            OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file_ == INVALID_HANDLE_VALUE) return;
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file_, &size) || size.QuadPart == 0) return;
+        mapping_ = CreateFileMappingA(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping_) return;
+        data_ = MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0);
+        if (data_) size_ = static_cast<size_t>(size.QuadPart);
+#else
+        fd_ = open(path.c_str(), O_RDONLY);
+        if (fd_ < 0) return;
+        struct stat info;
+        if (fstat(fd_, &info) != 0 || info.st_size == 0) return;
+        void* data = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd_, 0);
+        if (data == MAP_FAILED) return;
+        // The whole mesh is uploaded right away: ask for read-ahead
+        madvise(data, static_cast<size_t>(info.st_size), MADV_WILLNEED);
+        data_ = data;
+        size_ = static_cast<size_t>(info.st_size);
+#endif
+    }
+
+    ~MappedFile() {
+#ifdef _WIN32
+        if (data_) UnmapViewOfFile(data_);
+        if (mapping_) CloseHandle(mapping_);
+        if (file_ != INVALID_HANDLE_VALUE) CloseHandle(file_);
+#else
+        if (data_) munmap(data_, size_);
+        if (fd_ >= 0) close(fd_);
+#endif
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const unsigned char* data() const { return static_cast<const unsigned char*>(data_); }
+    size_t size() const { return size_; }
+    bool isOpen() const { return data_ != nullptr; }
+
+private:
+    void* data_ = nullptr;
+    size_t size_ = 0;
+#ifdef _WIN32
+    HANDLE file_ = INVALID_HANDLE_VALUE;
+    HANDLE mapping_ = nullptr;
+#else
+    int fd_ = -1;
+#endif
+};
+
+/**
+ * @brief Validates a mapped cooked mesh: header, layout, bounds of both data
+ * blocks and every index against vertex_count.
+ * @throws std::runtime_error on a bad magic, unsupported version or layout,
+ *         truncated file or out-of-range index.
+ */
+inline const Header& readHeader(const MappedFile& file, const std::string& path) {
+    if (!file.isOpen()) {
+        throw std::runtime_error("Failed to map cooked mesh: " + path);
+    }
+    if (file.size() < sizeof(Header)) {
+        throw std::runtime_error("Cooked mesh too small: " + path);
+    }
+
+    const Header& header = *reinterpret_cast<const Header*>(file.data());
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) {
+        throw std::runtime_error("Not a cooked mesh: " + path);
+    }
+    if (header.version != VERSION) {
+        throw std::runtime_error("Unsupported cooked mesh version " + std::to_string(header.version) + ": " + path);
+    }
+    if (header.attribute_count > MAX_ATTRIBUTES) {
+        throw std::runtime_error("Too many attributes in cooked mesh: " + path);
+    }
+    bool valid_layout = header.position_size >= 2 && header.position_size <= MAX_COMPONENTS;
+    for (uint32_t i = 0; i < header.attribute_count; i++) {
+        valid_layout = valid_layout && header.attribute_sizes[i] >= 1 && header.attribute_sizes[i] <= MAX_COMPONENTS;
+    }
+    if (!valid_layout) {
+        throw std::runtime_error("Unsupported vertex layout in cooked mesh: " + path);
+    }
+
+    // The layout checks above bound the stride to 20 floats, so these cannot
+    // overflow 64 bits; compare against the space left after each offset so
+    // the sums cannot wrap either
+    uint64_t file_size = file.size();
+    uint64_t vertex_bytes = static_cast<uint64_t>(header.vertex_count) * header.stride() * sizeof(float);
+    uint64_t index_bytes = static_cast<uint64_t>(header.index_count) * sizeof(unsigned int);
+    if (header.vertex_offset % 4 != 0 || header.index_offset % 4 != 0 ||
+        header.vertex_offset < sizeof(Header) || header.index_offset < sizeof(Header) ||
+        header.vertex_offset > file_size || vertex_bytes > file_size - header.vertex_offset ||
+        header.index_offset > file_size || index_bytes > file_size - header.index_offset) {
+        throw std::runtime_error("Truncated cooked mesh: " + path);
+    }
+
+    const uint32_t* indices = reinterpret_cast<const uint32_t*>(file.data() + header.index_offset);
+    for (uint32_t i = 0; i < header.index_count; i++) {
+        if (indices[i] >= header.vertex_count) {
+            throw std::runtime_error("Index " + std::to_string(indices[i]) + " out of range (" +
+                                     std::to_string(header.vertex_count) + " vertices) in cooked mesh: " + path);
+        }
+    }
+    return header;
+}
+
+/**
+ * @brief Maps a cooked mesh and creates a Geometry straight from the mapping.
+ * @throws std::runtime_error if the file is missing or invalid.
+ */
+inline geometry::GeometryPtr load(const std::string& path) {
+    MappedFile file(path);
+    const Header& header = readHeader(file, path);
+
+    const float* vertices = reinterpret_cast<const float*>(file.data() + header.vertex_offset);
+    const unsigned int* indices = reinterpret_cast<const unsigned int*>(file.data() + header.index_offset);
+    int a[MAX_ATTRIBUTES];
+    for (uint32_t i = 0; i < MAX_ATTRIBUTES; i++) a[i] = static_cast<int>(header.attribute_sizes[i]);
+
+    // Geometry::Make takes the attribute sizes as a braced list
+    switch (header.attribute_count) {
+        case 0: return geometry::Geometry::Make(vertices, indices, header.vertex_count, header.index_count,
+                                                header.position_size, {});
+        case 1: return geometry::Geometry::Make(vertices, indices, header.vertex_count, header.index_count,
+                                                header.position_size, {a[0]});
+        case 2: return geometry::Geometry::Make(vertices, indices, header.vertex_count, header.index_count,
+                                                header.position_size, {a[0], a[1]});
+        case 3: return geometry::Geometry::Make(vertices, indices, header.vertex_count, header.index_count,
+                                                header.position_size, {a[0], a[1], a[2]});
+        default: return geometry::Geometry::Make(vertices, indices, header.vertex_count, header.index_count,
+                                                 header.position_size, {a[0], a[1], a[2], a[3]});
+    }
+}
+
+} // namespace cooked
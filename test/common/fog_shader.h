@@ -0,0 +1,61 @@
+#pragma once
+
+#include <EnGene.h>
+#include <gl_base/material.h>
+#include <string>
+#include "shader_variants.h"
+
+/**
+ * @brief The lit fog shader (clip_plane_vertex.glsl + fragment_fog.glsl) as a variants::VariantSet.
+ *
+ * ClipPlaneFogTest and the benchmarks built on its scene share this setup:
+ * the three texture flags of fragment_fog.glsl become compile-time
+ * features, and every variant binds the camera and SceneLights blocks,
+ * tracks u_model, takes the material defaults and sets the fog parameters
+ * once on the program (they are scene-wide constants, so no per-draw
+ * provider is needed).
+ *
+ * Paths are passed in so each caller resolves them its own way (relative to
+ * the working directory, or through bench::Harness::corePath()). Must be
+ * called after the lights are created, so the SceneLights UBO exists.
+ *
+ * Usage:
+ * @code
+ * auto fog_variants = fogshader::makeVariants(
+ *     "core_gene/shaders/clip_plane_vertex.glsl", "core_gene/shaders/fragment_fog.glsl",
+ *     glm::vec3(0.5f, 0.6f, 0.7f), 0.08f);
+ * auto plain = fog_variants.get<variants::mask<>>();
+ * auto normal_mapped = fog_variants.get<variants::mask<fogshader::NORMAL_MAP>>();
+ * @endcode
+ */
+namespace fogshader {
+
+/// Feature bits, in the order makeVariants() declares them.
+enum : variants::Mask {
+    NORMAL_MAP = 1u << 0,
+    ROUGHNESS_MAP = 1u << 1,
+    DIFFUSE_MAP = 1u << 2
+};
+
+inline variants::VariantSet makeVariants(const std::string& vertex_path, const std::string& fragment_path,
+                                         const glm::vec3& fog_color, float fog_density) {
+    return variants::VariantSet(
+        variants::readFile(vertex_path),
+        variants::readFile(fragment_path),
+        {
+            {"HAS_NORMAL_MAP", "u_hasNormalMap"},
+            {"HAS_ROUGHNESS_MAP", "u_hasRoughnessMap"},
+            {"HAS_DIFFUSE_MAP", "u_hasDiffuseMap"}
+        },
+        [fog_color, fog_density](const shader::ShaderPtr& shader) {
+            shader->addResourceBlockToBind("CameraMatrices");
+            shader->addResourceBlockToBind("CameraPosition");
+            shader->addResourceBlockToBind("SceneLights");
+            shader->configureDynamicUniform<glm::mat4>("u_model", transform::current);
+            material::stack()->configureShaderDefaults(shader);
+            shader->setUniform<glm::vec3>("fogcolor", fog_color);
+            shader->setUniform<float>("fogdensity", fog_density);
+        });
+}
+
+} // namespace fogshader
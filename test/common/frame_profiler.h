@@ -0,0 +1,314 @@
+#pragma once
+
+#include <EnGene.h>
+#include <chrono>
+#include <deque>
+#include <fstream>
+#include <iomanip>
+#include <ostream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Opt-in frame profiler for test scenes.
+ *
+ * Records nested CPU scopes and, optionally, GL_TIME_ELAPSED queries per
+ * scope. A frame runs from one newFrame() call to the next, so calling
+ * newFrame() at the top of on_render makes each frame cover fixed update,
+ * render and buffer swap; time not covered by a top-level scope is reported
+ * as "untracked" (swap, event polling, engine overhead).
+ *
+ * GPU results are never waited on: each query is polled with
+ * GL_QUERY_RESULT_AVAILABLE on later newFrame() calls and its query object is
+ * recycled once read. GL_TIME_ELAPSED queries cannot nest, so a GPU scope
+ * opened inside another GPU scope is recorded as CPU-only.
+ *
+ * Usage:
+ * @code
+ * profiler::recorder().setEnabled(true);
+ * auto on_render = [](double alpha) {
+ *     profiler::recorder().newFrame();
+ *     profiler::Scope render_scope("render");
+ *     {
+ *         profiler::Scope draw_scope("draw", true);  // CPU + GPU timing
+ *         scene::graph()->draw();
+ *     }
+ * };
+ * @endcode
+ */
+namespace profiler {
+
+/**
+ * @brief One closed scope inside a frame.
+ *
+ * Times are in microseconds relative to profiler creation. gpu_duration_us
+ * stays negative until the query result arrives (or forever for CPU-only
+ * scopes).
+ */
+struct Event {
+    std::string name;
+    int depth = 0;
+    double start_us = 0.0;
+    double duration_us = 0.0;
+    double gpu_duration_us = -1.0;
+};
+
+struct FrameRecord {
+    unsigned long long index = 0;
+    double start_us = 0.0;
+    double duration_us = 0.0;
+    std::vector<Event> events;
+};
+
+class FrameProfiler {
+public:
+    FrameProfiler() : origin_(std::chrono::steady_clock::now()) {}
+
+    void setEnabled(bool enabled) { enabled_ = enabled; }
+    bool isEnabled() const { return enabled_; }
+
+    /**
+     * @brief Sets how many completed frames are kept for lastFrame()/export.
+     */
+    void setHistorySize(size_t frames) {
+        history_size_ = frames > 0 ? frames : 1;
+        while (history_.size() > history_size_) history_.pop_front();
+    }
+
+    /**
+     * @brief Closes the current frame (if any) and opens the next one.
+     *
+     * Also collects any GPU query results that have become available.
+     */
+    void newFrame() {
+        if (!enabled_) return;
+
+        double now = nowUs();
+        if (frame_open_) {
+            // Close scopes the caller left open so the tree stays well-formed
+            while (!open_scopes_.empty()) endScope();
+
+            current_.duration_us = now - current_.start_us;
+            history_.push_back(std::move(current_));
+            while (history_.size() > history_size_) history_.pop_front();
+        }
+
+        collectGpuResults();
+
+        current_ = FrameRecord();
+        current_.index = next_frame_index_++;
+        current_.start_us = now;
+        frame_open_ = true;
+    }
+
+    /**
+     * @brief Opens a named scope. Prefer the RAII profiler::Scope wrapper.
+     * @param gpu Also time this scope on the GPU with GL_TIME_ELAPSED.
+     */
+    void beginScope(const std::string& name, bool gpu = false) {
+        if (!enabled_ || !frame_open_) return;
+
+        OpenScope scope;
+        scope.event_index = current_.events.size();
+        scope.gpu = gpu && !gpu_query_active_;
+
+        Event event;
+        event.name = name;
+        event.depth = static_cast<int>(open_scopes_.size());
+        event.start_us = nowUs();
+        current_.events.push_back(event);
+
+        if (scope.gpu) {
+            scope.query = acquireQuery();
+            glBeginQuery(GL_TIME_ELAPSED, scope.query);
+            gpu_query_active_ = true;
+        }
+        open_scopes_.push_back(scope);
+    }
+
+    void endScope() {
+        if (!enabled_ || open_scopes_.empty()) return;
+
+        OpenScope scope = open_scopes_.back();
+        open_scopes_.pop_back();
+
+        Event& event = current_.events[scope.event_index];
+        event.duration_us = nowUs() - event.start_us;
+
+        if (scope.gpu) {
+            glEndQuery(GL_TIME_ELAPSED);
+            gpu_query_active_ = false;
+            pending_.push_back({scope.query, current_.index, scope.event_index});
+        }
+    }
+
+    /**
+     * @brief Most recent completed frame, or nullptr before the first one.
+     */
+    const FrameRecord* lastFrame() const {
+        return history_.empty() ? nullptr : &history_.back();
+    }
+
+    const std::deque<FrameRecord>& history() const { return history_; }
+
+    /**
+     * @brief Prints one frame as an indented scope tree with CPU/GPU times.
+     */
+    void printFrame(std::ostream& out, const FrameRecord& frame) const {
+        out << std::fixed << std::setprecision(3);
+        out << "Frame " << frame.index << ": " << frame.duration_us / 1000.0 << " ms" << std::endl;
+
+        double tracked_us = 0.0;
+        for (const auto& event : frame.events) {
+            if (event.depth == 0) tracked_us += event.duration_us;
+
+            out << std::string(2 + event.depth * 2, ' ') << std::left << std::setw(24) << event.name
+                << std::right << event.duration_us / 1000.0 << " ms";
+            if (event.gpu_duration_us >= 0.0) {
+                out << "  (gpu " << event.gpu_duration_us / 1000.0 << " ms)";
+            }
+            out << std::endl;
+        }
+
+        out << "  " << std::left << std::setw(24) << "untracked"
+            << std::right << (frame.duration_us - tracked_us) / 1000.0 << " ms" << std::endl;
+        out << std::defaultfloat;
+    }
+
+    /**
+     * @brief Writes all frames in history as Chrome trace JSON (chrome://tracing, Perfetto).
+     *
+     * CPU scopes go on thread 0 and GPU timings on thread 1; GPU events use the
+     * CPU start time since GL_TIME_ELAPSED only reports durations.
+     * @return false if the file could not be opened.
+     */
+    bool writeChromeTrace(const std::string& path) const {
+        std::ofstream file(path);
+        if (!file.is_open()) return false;
+
+        file << std::fixed << std::setprecision(3);
+        file << "{\"traceEvents\":[";
+        bool first = true;
+        auto writeEvent = [&](const std::string& name, int tid, double ts, double dur) {
+            file << (first ? "\n" : ",\n")
+                 << "{\"name\":\"" << escape(name) << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << tid
+                 << ",\"ts\":" << ts << ",\"dur\":" << dur << "}";
+            first = false;
+        };
+
+        for (const auto& frame : history_) {
+            writeEvent("frame " + std::to_string(frame.index), 0, frame.start_us, frame.duration_us);
+            for (const auto& event : frame.events) {
+                writeEvent(event.name, 0, event.start_us, event.duration_us);
+                if (event.gpu_duration_us >= 0.0) {
+                    writeEvent(event.name, 1, event.start_us, event.gpu_duration_us);
+                }
+            }
+        }
+
+        file << "\n],\"displayTimeUnit\":\"ms\"}" << std::endl;
+        return true;
+    }
+
+private:
+    struct OpenScope {
+        size_t event_index = 0;
+        bool gpu = false;
+        GLuint query = 0;
+    };
+
+    struct PendingQuery {
+        GLuint query;
+        unsigned long long frame_index;
+        size_t event_index;
+    };
+
+    double nowUs() const {
+        return std::chrono::duration<double, std::micro>(
+            std::chrono::steady_clock::now() - origin_).count();
+    }
+
+    GLuint acquireQuery() {
+        if (!free_queries_.empty()) {
+            GLuint query = free_queries_.back();
+            free_queries_.pop_back();
+            return query;
+        }
+        GLuint query = 0;
+        glGenQueries(1, &query);
+        return query;
+    }
+
+    void collectGpuResults() {
+        size_t kept = 0;
+        for (size_t i = 0; i < pending_.size(); i++) {
+            PendingQuery pending = pending_[i];
+
+            GLint available = 0;
+            glGetQueryObjectiv(pending.query, GL_QUERY_RESULT_AVAILABLE, &available);
+            if (!available) {
+                pending_[kept++] = pending;
+                continue;
+            }
+
+            GLuint64 elapsed_ns = 0;
+            glGetQueryObjectui64v(pending.query, GL_QUERY_RESULT, &elapsed_ns);
+            free_queries_.push_back(pending.query);
+
+            // The frame may already have dropped out of history
+            for (auto& frame : history_) {
+                if (frame.index == pending.frame_index) {
+                    frame.events[pending.event_index].gpu_duration_us = elapsed_ns / 1000.0;
+                    break;
+                }
+            }
+        }
+        pending_.resize(kept);
+    }
+
+    static std::string escape(const std::string& text) {
+        std::string result;
+        for (char c : text) {
+            if (c == '"' || c == '\\') result += '\\';
+            result += c;
+        }
+        return result;
+    }
+
+    std::chrono::steady_clock::time_point origin_;
+    bool enabled_ = false;
+    bool frame_open_ = false;
+    bool gpu_query_active_ = false;
+    size_t history_size_ = 120;
+    unsigned long long next_frame_index_ = 0;
+
+    FrameRecord current_;
+    std::deque<FrameRecord> history_;
+    std::vector<OpenScope> open_scopes_;
+    std::vector<PendingQuery> pending_;
+    std::vector<GLuint> free_queries_;
+};
+
+/**
+ * @brief Global profiler instance.
+ */
+inline FrameProfiler& recorder() {
+    static FrameProfiler instance;
+    return instance;
+}
+
+/**
+ * @brief RAII scope: opens on construction, closes on destruction.
+ */
+class Scope {
+public:
+    explicit Scope(const std::string& name, bool gpu = false) {
+        recorder().beginScope(name, gpu);
+    }
+    ~Scope() { recorder().endScope(); }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+};
+
+} // namespace profiler
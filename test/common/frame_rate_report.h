@@ -0,0 +1,51 @@
+#pragma once
+
+#include <EnGene.h>
+#include <chrono>
+#include <iostream>
+
+/**
+ * @brief Periodic average frame time printout for interactive stress scenes.
+ *
+ * Counts frames and, every interval seconds, prints the mean frame time and
+ * frame rate over that interval. Start it at the end of on_initialize so
+ * scene construction is not counted as the first frame.
+ *
+ * Usage:
+ * @code
+ * framerate::Report report(2.0);
+ * auto on_init = [&](engene::EnGene& app) { ...; report.start(); };
+ * auto on_render = [&](double alpha) { ...; report.frame(); };
+ * @endcode
+ */
+namespace framerate {
+
+class Report {
+public:
+    explicit Report(double interval_seconds) : interval_(interval_seconds) {}
+
+    void start() {
+        start_ = std::chrono::steady_clock::now();
+        frames_ = 0;
+    }
+
+    /// Call once per frame, at the end of on_render.
+    void frame() {
+        frames_++;
+        auto now = std::chrono::steady_clock::now();
+        double elapsed = std::chrono::duration<double>(now - start_).count();
+        if (elapsed >= interval_) {
+            std::cout << "Frame time: " << (elapsed * 1000.0 / frames_) << " ms ("
+                      << (frames_ / elapsed) << " fps)" << std::endl;
+            frames_ = 0;
+            start_ = now;
+        }
+    }
+
+private:
+    double interval_;
+    std::chrono::steady_clock::time_point start_;
+    int frames_ = 0;
+};
+
+} // namespace framerate
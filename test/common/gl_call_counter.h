@@ -0,0 +1,680 @@
+#pragma once
+
+#include <EnGene.h>
+#include <algorithm>
+#include <map>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+/**
+ * @brief Counts GL calls made by the engine and the test, per frame, and
+ * tracks the GL objects they keep alive.
+ *
+ * install() swaps glad's function pointers for thin wrappers that bump a
+ * counter and forward to the driver. Because EnGene and the test both call GL
+ * through the same glad pointers, this sees every draw, bind and uniform
+ * upload without any hooks inside CoreGene. Buffer uploads include mapped
+ * writes (glMapBufferRange), counted by explicit flush or, without
+ * GL_MAP_FLUSH_EXPLICIT_BIT, by the mapped range, so streaming through
+ * stream::RingBuffer shows up in buffer_updates and bytes_uploaded.
+ *
+ * The same wrappers follow object creation and deletion, and the storage
+ * given to buffers, textures and renderbuffers, so resources() reports live
+ * totals by type: a count that only grows over a long session is a leak.
+ * Only objects created after install() are tracked. Texture storage is
+ * followed for 2D textures and cubemaps, at the driver's nominal texel
+ * size; padding and compression are not modelled. Storage given through
+ * other entry points is not seen, and those objects count with 0 bytes:
+ * glBufferStorage, glTexImage3D / glTexStorage3D (2D arrays, 3D),
+ * glTexImage2DMultisample / glTexStorage2DMultisample,
+ * glCompressedTexImage2D and glRenderbufferStorageMultisample. The bound
+ * object for each storage call comes from bindings cached by the bind
+ * wrappers, so per-frame re-specification (e.g. UBO orphaning) costs no
+ * glGetIntegerv. Other glad hooks chain
+ * with these, last installed running first, so install texbudget after
+ * this to have clamped uploads counted at their clamped size.
+ *
+ * writeJson() and writePrometheus() format both for logs or telemetry.
+ *
+ * Must be called after the GL context is current and glad is loaded (e.g. in
+ * on_initialize), before the resources to track are created. Counters
+ * accumulate until reset(); resources are never reset.
+ *
+ * Usage:
+ * @code
+ * glstats::install();
+ * // ... once per frame:
+ * glstats::Counters frame = glstats::counters();
+ * glstats::reset();
+ * // ... whenever telemetry is scraped:
+ * glstats::writePrometheus(out, frame, glstats::resources());
+ * @endcode
+ */
+
+#ifndef APIENTRY
+#define APIENTRY
+#endif
+
+namespace glstats {
+
+struct Counters {
+    unsigned long long draw_calls = 0;
+    unsigned long long triangles = 0;
+    unsigned long long program_binds = 0;
+    unsigned long long texture_binds = 0;
+    unsigned long long framebuffer_binds = 0;
+    unsigned long long vertex_array_binds = 0;
+    unsigned long long state_changes = 0;     // enable/disable, blend, depth, stencil
+    unsigned long long uniform_uploads = 0;
+    unsigned long long buffer_updates = 0;    // glBufferData / glBufferSubData calls, mapped writes
+    unsigned long long bytes_uploaded = 0;    // their payloads (mapped: flushed or mapped range)
+    unsigned long long buffer_binds = 0;      // glBindBufferBase / glBindBufferRange (UBO/SSBO bindings)
+};
+
+inline Counters& counters() {
+    static Counters instance;
+    return instance;
+}
+
+inline void reset() { counters() = Counters(); }
+
+/// Calls f(name, value) for every counter, in declaration order.
+template <typename F>
+void forEachCounter(const Counters& c, F f) {
+    f("draw_calls", c.draw_calls);
+    f("triangles", c.triangles);
+    f("program_binds", c.program_binds);
+    f("texture_binds", c.texture_binds);
+    f("framebuffer_binds", c.framebuffer_binds);
+    f("vertex_array_binds", c.vertex_array_binds);
+    f("state_changes", c.state_changes);
+    f("uniform_uploads", c.uniform_uploads);
+    f("buffer_updates", c.buffer_updates);
+    f("bytes_uploaded", c.bytes_uploaded);
+    f("buffer_binds", c.buffer_binds);
+}
+
+inline Counters& operator+=(Counters& sum, const Counters& c) {
+    sum.draw_calls += c.draw_calls;
+    sum.triangles += c.triangles;
+    sum.program_binds += c.program_binds;
+    sum.texture_binds += c.texture_binds;
+    sum.framebuffer_binds += c.framebuffer_binds;
+    sum.vertex_array_binds += c.vertex_array_binds;
+    sum.state_changes += c.state_changes;
+    sum.uniform_uploads += c.uniform_uploads;
+    sum.buffer_updates += c.buffer_updates;
+    sum.bytes_uploaded += c.bytes_uploaded;
+    sum.buffer_binds += c.buffer_binds;
+    return sum;
+}
+
+/// Live GL objects created since install(), and the storage they hold.
+struct Resources {
+    unsigned long long buffers = 0;
+    unsigned long long textures = 0;
+    unsigned long long renderbuffers = 0;
+    unsigned long long framebuffers = 0;
+    unsigned long long vertex_arrays = 0;
+    unsigned long long programs = 0;
+    unsigned long long buffer_bytes = 0;
+    unsigned long long texture_bytes = 0;
+    unsigned long long renderbuffer_bytes = 0;
+};
+
+template <typename F>
+void forEachResource(const Resources& r, F f) {
+    f("buffers", r.buffers);
+    f("textures", r.textures);
+    f("renderbuffers", r.renderbuffers);
+    f("framebuffers", r.framebuffers);
+    f("vertex_arrays", r.vertex_arrays);
+    f("programs", r.programs);
+    f("buffer_bytes", r.buffer_bytes);
+    f("texture_bytes", r.texture_bytes);
+    f("renderbuffer_bytes", r.renderbuffer_bytes);
+}
+
+namespace detail {
+
+inline unsigned long long trianglesFor(GLenum mode, GLsizei count) {
+    switch (mode) {
+        case GL_TRIANGLES: return count / 3;
+        case GL_TRIANGLE_STRIP:
+        case GL_TRIANGLE_FAN: return count > 2 ? count - 2 : 0;
+        default: return 0;
+    }
+}
+
+// Nominal storage per texel for the sized and unsized formats EnGene uses
+inline unsigned long long bytesPerTexel(GLint internal_format) {
+    switch (internal_format) {
+        case GL_R8: case GL_RED: case GL_STENCIL_INDEX8: return 1;
+        case GL_RG8: case GL_RG: case GL_R16F: case GL_DEPTH_COMPONENT16: return 2;
+        case GL_RGB8: case GL_RGB: case GL_SRGB8: return 3;
+        case GL_RGB16F: return 6;
+        case GL_RGBA16F: case GL_RG32F: case GL_DEPTH32F_STENCIL8: return 8;
+        case GL_RGB32F: return 12;
+        case GL_RGBA32F: return 16;
+        default: return 4;   // RGBA8, SRGB8_ALPHA8, R32F, depth 24/32, depth-stencil
+    }
+}
+
+struct TextureLevel {
+    unsigned long long width = 0, height = 0, bytes_per_texel = 0;
+    unsigned long long bytes() const { return width * height * bytes_per_texel; }
+};
+
+// Every object created through the wrappers, with the storage last given to it
+struct Tracker {
+    std::unordered_map<GLuint, unsigned long long> buffers;
+    std::unordered_map<GLuint, std::map<int, TextureLevel>> textures;   // key: face * 64 + level
+    std::unordered_map<GLuint, unsigned long long> renderbuffers;
+    std::unordered_set<GLuint> framebuffers;
+    std::unordered_set<GLuint> vertex_arrays;
+    std::unordered_set<GLuint> programs;
+};
+
+inline Tracker& tracker() {
+    static Tracker instance;
+    return instance;
+}
+
+// Bindings seen through the wrappers, so storage calls find their object
+// without a glGetIntegerv in every glBufferData / glTexImage2D. A missing
+// entry means unknown (bound before install(), or an element buffer
+// switched by a VAO bind) and is queried once, then cached.
+struct Bindings {
+    std::unordered_map<GLenum, GLuint> buffers;                     // by target
+    std::map<std::pair<GLenum, GLenum>, GLuint> textures;           // by (unit, binding target)
+    GLenum active_texture = GL_TEXTURE0;
+    bool renderbuffer_known = false;
+    GLuint renderbuffer = 0;
+};
+
+inline Bindings& bindings() {
+    static Bindings instance;
+    return instance;
+}
+
+inline GLenum bufferBindingQuery(GLenum target) {
+    switch (target) {
+        case GL_ARRAY_BUFFER: return GL_ARRAY_BUFFER_BINDING;
+        case GL_ELEMENT_ARRAY_BUFFER: return GL_ELEMENT_ARRAY_BUFFER_BINDING;
+        case GL_UNIFORM_BUFFER: return GL_UNIFORM_BUFFER_BINDING;
+        case GL_SHADER_STORAGE_BUFFER: return GL_SHADER_STORAGE_BUFFER_BINDING;
+        default: return 0;
+    }
+}
+
+inline GLuint boundBuffer(GLenum target) {
+    auto& cached = bindings().buffers;
+    auto it = cached.find(target);
+    if (it != cached.end()) return it->second;
+
+    GLenum query = bufferBindingQuery(target);
+    if (!query) return 0;
+    GLint buffer = 0;
+    glGetIntegerv(query, &buffer);
+    return cached[target] = static_cast<GLuint>(buffer);
+}
+
+// Bound texture and cubemap face index (0 for 2D) for an upload target
+inline GLuint boundTexture(GLenum target, int& face) {
+    GLenum binding_target = 0, query = 0;
+    face = 0;
+    if (target == GL_TEXTURE_2D) {
+        binding_target = GL_TEXTURE_2D;
+        query = GL_TEXTURE_BINDING_2D;
+    } else if (target >= GL_TEXTURE_CUBE_MAP_POSITIVE_X && target <= GL_TEXTURE_CUBE_MAP_NEGATIVE_Z) {
+        binding_target = GL_TEXTURE_CUBE_MAP;
+        query = GL_TEXTURE_BINDING_CUBE_MAP;
+        face = static_cast<int>(target - GL_TEXTURE_CUBE_MAP_POSITIVE_X);
+    } else if (target == GL_TEXTURE_CUBE_MAP) {
+        binding_target = GL_TEXTURE_CUBE_MAP;
+        query = GL_TEXTURE_BINDING_CUBE_MAP;
+    } else {
+        return 0;
+    }
+
+    auto key = std::make_pair(bindings().active_texture, binding_target);
+    auto it = bindings().textures.find(key);
+    if (it != bindings().textures.end()) return it->second;
+
+    GLint texture = 0;
+    glGetIntegerv(query, &texture);
+    return bindings().textures[key] = static_cast<GLuint>(texture);
+}
+
+inline GLuint boundRenderbuffer() {
+    if (!bindings().renderbuffer_known) {
+        GLint renderbuffer = 0;
+        glGetIntegerv(GL_RENDERBUFFER_BINDING, &renderbuffer);
+        bindings().renderbuffer = static_cast<GLuint>(renderbuffer);
+        bindings().renderbuffer_known = true;
+    }
+    return bindings().renderbuffer;
+}
+
+// Deleting a bound object reverts its bindings to 0
+inline void unbindDeleted(GLsizei n, const GLuint* ids, std::unordered_map<GLenum, GLuint>& table) {
+    for (auto& binding : table) {
+        if (std::find(ids, ids + n, binding.second) != ids + n) binding.second = 0;
+    }
+}
+
+inline void unbindDeleted(GLsizei n, const GLuint* ids, std::map<std::pair<GLenum, GLenum>, GLuint>& table) {
+    for (auto& binding : table) {
+        if (std::find(ids, ids + n, binding.second) != ids + n) binding.second = 0;
+    }
+}
+
+inline void trackBufferData(GLenum target, GLsizeiptr size) {
+    auto it = tracker().buffers.find(boundBuffer(target));
+    if (it != tracker().buffers.end()) it->second = static_cast<unsigned long long>(size);
+}
+
+inline void trackTexImage(GLenum target, GLint level, GLint internal_format, GLsizei width, GLsizei height) {
+    int face = 0;
+    auto it = tracker().textures.find(boundTexture(target, face));
+    if (it == tracker().textures.end()) return;
+    TextureLevel& entry = it->second[face * 64 + level];
+    entry.width = width;
+    entry.height = height;
+    entry.bytes_per_texel = bytesPerTexel(internal_format);
+}
+
+inline void trackTexStorage(GLenum target, GLsizei levels, GLenum internal_format, GLsizei width, GLsizei height) {
+    int faces = (target == GL_TEXTURE_CUBE_MAP) ? 6 : 1;
+    for (int level = 0; level < levels; level++) {
+        GLsizei w = std::max(1, width >> level), h = std::max(1, height >> level);
+        for (int face = 0; face < faces; face++) {
+            GLenum face_target = (faces == 6) ? GL_TEXTURE_CUBE_MAP_POSITIVE_X + face : target;
+            trackTexImage(face_target, level, internal_format, w, h);
+        }
+    }
+}
+
+// Fills in the chain below level 0 for every face that has one
+inline void trackGenerateMipmap(GLenum target) {
+    int unused = 0;
+    auto it = tracker().textures.find(boundTexture(target, unused));
+    if (it == tracker().textures.end()) return;
+
+    std::map<int, TextureLevel>& levels = it->second;
+    for (int face = 0; face < 6; face++) {
+        auto base = levels.find(face * 64);
+        if (base == levels.end()) continue;
+        TextureLevel level = base->second;
+        for (int i = 1; level.width > 1 || level.height > 1; i++) {
+            level.width = std::max(1ull, level.width / 2);
+            level.height = std::max(1ull, level.height / 2);
+            levels[face * 64 + i] = level;
+        }
+    }
+}
+
+inline void trackRenderbufferStorage(GLenum internal_format, GLsizei width, GLsizei height) {
+    auto it = tracker().renderbuffers.find(boundRenderbuffer());
+    if (it != tracker().renderbuffers.end()) {
+        it->second = static_cast<unsigned long long>(width) * height * bytesPerTexel(internal_format);
+    }
+}
+
+template <typename Storage>
+void trackCreated(std::unordered_map<GLuint, Storage>& table, GLsizei n, const GLuint* ids) {
+    for (GLsizei i = 0; i < n; i++) table[ids[i]] = Storage();
+}
+
+inline void trackCreated(std::unordered_set<GLuint>& table, GLsizei n, const GLuint* ids) {
+    for (GLsizei i = 0; i < n; i++) table.insert(ids[i]);
+}
+
+template <typename Table>
+void trackDeleted(Table& table, GLsizei n, const GLuint* ids) {
+    for (GLsizei i = 0; i < n; i++) table.erase(ids[i]);
+}
+
+// Declares the saved driver pointer and a counting wrapper for one GL entry point
+#define GLSTATS_WRAP(pfn, fn, params, args, ...) \
+    inline pfn real_##fn = nullptr; \
+    inline void APIENTRY counted_##fn params { __VA_ARGS__; real_##fn args; }
+
+// Draws
+GLSTATS_WRAP(PFNGLDRAWARRAYSPROC, glDrawArrays,
+    (GLenum mode, GLint first, GLsizei count), (mode, first, count),
+    counters().draw_calls++, counters().triangles += trianglesFor(mode, count))
+GLSTATS_WRAP(PFNGLDRAWELEMENTSPROC, glDrawElements,
+    (GLenum mode, GLsizei count, GLenum type, const void* indices), (mode, count, type, indices),
+    counters().draw_calls++, counters().triangles += trianglesFor(mode, count))
+GLSTATS_WRAP(PFNGLDRAWARRAYSINSTANCEDPROC, glDrawArraysInstanced,
+    (GLenum mode, GLint first, GLsizei count, GLsizei instances), (mode, first, count, instances),
+    counters().draw_calls++, counters().triangles += trianglesFor(mode, count) * instances)
+GLSTATS_WRAP(PFNGLDRAWELEMENTSINSTANCEDPROC, glDrawElementsInstanced,
+    (GLenum mode, GLsizei count, GLenum type, const void* indices, GLsizei instances),
+    (mode, count, type, indices, instances),
+    counters().draw_calls++, counters().triangles += trianglesFor(mode, count) * instances)
+
+// Binds
+GLSTATS_WRAP(PFNGLUSEPROGRAMPROC, glUseProgram,
+    (GLuint program), (program), counters().program_binds++)
+GLSTATS_WRAP(PFNGLBINDTEXTUREPROC, glBindTexture,
+    (GLenum target, GLuint texture), (target, texture),
+    counters().texture_binds++, bindings().textures[std::make_pair(bindings().active_texture, target)] = texture)
+GLSTATS_WRAP(PFNGLACTIVETEXTUREPROC, glActiveTexture,
+    (GLenum texture), (texture), bindings().active_texture = texture)
+GLSTATS_WRAP(PFNGLBINDFRAMEBUFFERPROC, glBindFramebuffer,
+    (GLenum target, GLuint framebuffer), (target, framebuffer), counters().framebuffer_binds++)
+// The element buffer binding is VAO state, so it is unknown after a VAO bind
+GLSTATS_WRAP(PFNGLBINDVERTEXARRAYPROC, glBindVertexArray,
+    (GLuint array), (array),
+    counters().vertex_array_binds++, bindings().buffers.erase(GL_ELEMENT_ARRAY_BUFFER))
+
+// Fixed-function state
+GLSTATS_WRAP(PFNGLENABLEPROC, glEnable, (GLenum cap), (cap), counters().state_changes++)
+GLSTATS_WRAP(PFNGLDISABLEPROC, glDisable, (GLenum cap), (cap), counters().state_changes++)
+GLSTATS_WRAP(PFNGLBLENDFUNCPROC, glBlendFunc,
+    (GLenum src, GLenum dst), (src, dst), counters().state_changes++)
+GLSTATS_WRAP(PFNGLBLENDFUNCSEPARATEPROC, glBlendFuncSeparate,
+    (GLenum src_rgb, GLenum dst_rgb, GLenum src_alpha, GLenum dst_alpha),
+    (src_rgb, dst_rgb, src_alpha, dst_alpha), counters().state_changes++)
+GLSTATS_WRAP(PFNGLBLENDEQUATIONPROC, glBlendEquation,
+    (GLenum mode), (mode), counters().state_changes++)
+GLSTATS_WRAP(PFNGLBLENDEQUATIONSEPARATEPROC, glBlendEquationSeparate,
+    (GLenum mode_rgb, GLenum mode_alpha), (mode_rgb, mode_alpha), counters().state_changes++)
+GLSTATS_WRAP(PFNGLDEPTHFUNCPROC, glDepthFunc, (GLenum func), (func), counters().state_changes++)
+GLSTATS_WRAP(PFNGLDEPTHMASKPROC, glDepthMask, (GLboolean flag), (flag), counters().state_changes++)
+GLSTATS_WRAP(PFNGLSTENCILFUNCPROC, glStencilFunc,
+    (GLenum func, GLint ref, GLuint mask), (func, ref, mask), counters().state_changes++)
+GLSTATS_WRAP(PFNGLSTENCILOPPROC, glStencilOp,
+    (GLenum sfail, GLenum dpfail, GLenum dppass), (sfail, dpfail, dppass), counters().state_changes++)
+GLSTATS_WRAP(PFNGLSTENCILMASKPROC, glStencilMask, (GLuint mask), (mask), counters().state_changes++)
+
+// Uniforms: every glUniform* and glProgramUniform* entry point, listed as
+// X(name, type suffix, params, args) and pasted into gl<name><suffix>
+#define GLSTATS_UNIFORM_VALUES(X, t, T) \
+    X(Uniform1, t, (GLint location, T v0), (location, v0)) \
+    X(Uniform2, t, (GLint location, T v0, T v1), (location, v0, v1)) \
+    X(Uniform3, t, (GLint location, T v0, T v1, T v2), (location, v0, v1, v2)) \
+    X(Uniform4, t, (GLint location, T v0, T v1, T v2, T v3), (location, v0, v1, v2, v3)) \
+    X(Uniform1, t##v, (GLint location, GLsizei count, const T* value), (location, count, value)) \
+    X(Uniform2, t##v, (GLint location, GLsizei count, const T* value), (location, count, value)) \
+    X(Uniform3, t##v, (GLint location, GLsizei count, const T* value), (location, count, value)) \
+    X(Uniform4, t##v, (GLint location, GLsizei count, const T* value), (location, count, value)) \
+    X(ProgramUniform1, t, (GLuint program, GLint location, T v0), (program, location, v0)) \
+    X(ProgramUniform2, t, (GLuint program, GLint location, T v0, T v1), (program, location, v0, v1)) \
+    X(ProgramUniform3, t, (GLuint program, GLint location, T v0, T v1, T v2), \
+        (program, location, v0, v1, v2)) \
+    X(ProgramUniform4, t, (GLuint program, GLint location, T v0, T v1, T v2, T v3), \
+        (program, location, v0, v1, v2, v3)) \
+    X(ProgramUniform1, t##v, (GLuint program, GLint location, GLsizei count, const T* value), \
+        (program, location, count, value)) \
+    X(ProgramUniform2, t##v, (GLuint program, GLint location, GLsizei count, const T* value), \
+        (program, location, count, value)) \
+    X(ProgramUniform3, t##v, (GLuint program, GLint location, GLsizei count, const T* value), \
+        (program, location, count, value)) \
+    X(ProgramUniform4, t##v, (GLuint program, GLint location, GLsizei count, const T* value), \
+        (program, location, count, value))
+
+#define GLSTATS_UNIFORM_MATRIX(X, dims, t, T) \
+    X(UniformMatrix##dims, t##v, (GLint location, GLsizei count, GLboolean transpose, const T* value), \
+        (location, count, transpose, value)) \
+    X(ProgramUniformMatrix##dims, t##v, \
+        (GLuint program, GLint location, GLsizei count, GLboolean transpose, const T* value), \
+        (program, location, count, transpose, value))
+
+#define GLSTATS_UNIFORM_MATRICES(X, t, T) \
+    GLSTATS_UNIFORM_MATRIX(X, 2, t, T) GLSTATS_UNIFORM_MATRIX(X, 3, t, T) \
+    GLSTATS_UNIFORM_MATRIX(X, 4, t, T) GLSTATS_UNIFORM_MATRIX(X, 2x3, t, T) \
+    GLSTATS_UNIFORM_MATRIX(X, 3x2, t, T) GLSTATS_UNIFORM_MATRIX(X, 2x4, t, T) \
+    GLSTATS_UNIFORM_MATRIX(X, 4x2, t, T) GLSTATS_UNIFORM_MATRIX(X, 3x4, t, T) \
+    GLSTATS_UNIFORM_MATRIX(X, 4x3, t, T)
+
+#define GLSTATS_UNIFORM_FUNCTIONS(X) \
+    GLSTATS_UNIFORM_VALUES(X, f, GLfloat) GLSTATS_UNIFORM_VALUES(X, i, GLint) \
+    GLSTATS_UNIFORM_VALUES(X, ui, GLuint) GLSTATS_UNIFORM_VALUES(X, d, GLdouble) \
+    GLSTATS_UNIFORM_MATRICES(X, f, GLfloat) GLSTATS_UNIFORM_MATRICES(X, d, GLdouble)
+
+// The name is only ever pasted, so glad's glUniform* macros never expand here
+#define GLSTATS_WRAP_UNIFORM(name, t, params, args) \
+    GLSTATS_WRAP(decltype(glad_gl##name##t), gl##name##t, params, args, counters().uniform_uploads++)
+
+GLSTATS_UNIFORM_FUNCTIONS(GLSTATS_WRAP_UNIFORM)
+
+#undef GLSTATS_WRAP_UNIFORM
+
+// Buffer uploads
+GLSTATS_WRAP(PFNGLBUFFERDATAPROC, glBufferData,
+    (GLenum target, GLsizeiptr size, const void* data, GLenum usage), (target, size, data, usage),
+    counters().buffer_updates++,
+    counters().bytes_uploaded += data ? static_cast<unsigned long long>(size) : 0,
+    trackBufferData(target, size))
+GLSTATS_WRAP(PFNGLBUFFERSUBDATAPROC, glBufferSubData,
+    (GLenum target, GLintptr offset, GLsizeiptr size, const void* data), (target, offset, size, data),
+    counters().buffer_updates++, counters().bytes_uploaded += static_cast<unsigned long long>(size))
+// Mapped writes count when published: each explicit flush, or the whole
+// range at map time when the mapping is not GL_MAP_FLUSH_EXPLICIT_BIT
+GLSTATS_WRAP(PFNGLFLUSHMAPPEDBUFFERRANGEPROC, glFlushMappedBufferRange,
+    (GLenum target, GLintptr offset, GLsizeiptr length), (target, offset, length),
+    counters().buffer_updates++, counters().bytes_uploaded += static_cast<unsigned long long>(length))
+inline PFNGLMAPBUFFERRANGEPROC real_glMapBufferRange = nullptr;
+inline void* APIENTRY counted_glMapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length,
+                                               GLbitfield access) {
+    if ((access & GL_MAP_WRITE_BIT) && !(access & GL_MAP_FLUSH_EXPLICIT_BIT)) {
+        counters().buffer_updates++;
+        counters().bytes_uploaded += static_cast<unsigned long long>(length);
+    }
+    return real_glMapBufferRange(target, offset, length, access);
+}
+// Indexed binds also bind the target's generic binding point
+GLSTATS_WRAP(PFNGLBINDBUFFERPROC, glBindBuffer,
+    (GLenum target, GLuint buffer), (target, buffer), bindings().buffers[target] = buffer)
+GLSTATS_WRAP(PFNGLBINDBUFFERBASEPROC, glBindBufferBase,
+    (GLenum target, GLuint index, GLuint buffer), (target, index, buffer),
+    counters().buffer_binds++, bindings().buffers[target] = buffer)
+GLSTATS_WRAP(PFNGLBINDBUFFERRANGEPROC, glBindBufferRange,
+    (GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size),
+    (target, index, buffer, offset, size),
+    counters().buffer_binds++, bindings().buffers[target] = buffer)
+
+// Object lifetimes and storage (resources())
+#define GLSTATS_WRAP_GEN(pfn, fn, table) \
+    inline pfn real_##fn = nullptr; \
+    inline void APIENTRY counted_##fn(GLsizei n, GLuint* ids) { \
+        real_##fn(n, ids); trackCreated(tracker().table, n, ids); }
+#define GLSTATS_WRAP_DELETE(pfn, fn, table, ...) \
+    inline pfn real_##fn = nullptr; \
+    inline void APIENTRY counted_##fn(GLsizei n, const GLuint* ids) { \
+        trackDeleted(tracker().table, n, ids); __VA_ARGS__; real_##fn(n, ids); }
+
+GLSTATS_WRAP_GEN(PFNGLGENBUFFERSPROC, glGenBuffers, buffers)
+GLSTATS_WRAP_DELETE(PFNGLDELETEBUFFERSPROC, glDeleteBuffers, buffers,
+    unbindDeleted(n, ids, bindings().buffers))
+GLSTATS_WRAP_GEN(PFNGLGENTEXTURESPROC, glGenTextures, textures)
+GLSTATS_WRAP_DELETE(PFNGLDELETETEXTURESPROC, glDeleteTextures, textures,
+    unbindDeleted(n, ids, bindings().textures))
+GLSTATS_WRAP_GEN(PFNGLGENRENDERBUFFERSPROC, glGenRenderbuffers, renderbuffers)
+GLSTATS_WRAP_DELETE(PFNGLDELETERENDERBUFFERSPROC, glDeleteRenderbuffers, renderbuffers,
+    if (std::find(ids, ids + n, bindings().renderbuffer) != ids + n) bindings().renderbuffer = 0)
+GLSTATS_WRAP_GEN(PFNGLGENFRAMEBUFFERSPROC, glGenFramebuffers, framebuffers)
+GLSTATS_WRAP_DELETE(PFNGLDELETEFRAMEBUFFERSPROC, glDeleteFramebuffers, framebuffers)
+GLSTATS_WRAP_GEN(PFNGLGENVERTEXARRAYSPROC, glGenVertexArrays, vertex_arrays)
+GLSTATS_WRAP_DELETE(PFNGLDELETEVERTEXARRAYSPROC, glDeleteVertexArrays, vertex_arrays)
+
+#undef GLSTATS_WRAP_GEN
+#undef GLSTATS_WRAP_DELETE
+
+inline PFNGLCREATEPROGRAMPROC real_glCreateProgram = nullptr;
+inline GLuint APIENTRY counted_glCreateProgram() {
+    GLuint program = real_glCreateProgram();
+    if (program) tracker().programs.insert(program);
+    return program;
+}
+GLSTATS_WRAP(PFNGLDELETEPROGRAMPROC, glDeleteProgram,
+    (GLuint program), (program), tracker().programs.erase(program))
+
+GLSTATS_WRAP(PFNGLTEXIMAGE2DPROC, glTexImage2D,
+    (GLenum target, GLint level, GLint internal_format, GLsizei width, GLsizei height, GLint border,
+     GLenum format, GLenum type, const void* pixels),
+    (target, level, internal_format, width, height, border, format, type, pixels),
+    trackTexImage(target, level, internal_format, width, height))
+GLSTATS_WRAP(PFNGLTEXSTORAGE2DPROC, glTexStorage2D,
+    (GLenum target, GLsizei levels, GLenum internal_format, GLsizei width, GLsizei height),
+    (target, levels, internal_format, width, height),
+    trackTexStorage(target, levels, internal_format, width, height))
+GLSTATS_WRAP(PFNGLGENERATEMIPMAPPROC, glGenerateMipmap,
+    (GLenum target), (target), trackGenerateMipmap(target))
+GLSTATS_WRAP(PFNGLBINDRENDERBUFFERPROC, glBindRenderbuffer,
+    (GLenum target, GLuint renderbuffer), (target, renderbuffer),
+    bindings().renderbuffer = renderbuffer, bindings().renderbuffer_known = true)
+GLSTATS_WRAP(PFNGLRENDERBUFFERSTORAGEPROC, glRenderbufferStorage,
+    (GLenum target, GLenum internal_format, GLsizei width, GLsizei height),
+    (target, internal_format, width, height),
+    trackRenderbufferStorage(internal_format, width, height))
+
+#undef GLSTATS_WRAP
+
+inline bool& installed() {
+    static bool value = false;
+    return value;
+}
+
+} // namespace detail
+
+/**
+ * @brief Replaces glad's pointers with counting wrappers. Safe to call twice.
+ */
+inline void install() {
+    if (detail::installed()) return;
+
+    // The only binding state the cache cannot look up lazily
+    GLint active_texture = GL_TEXTURE0;
+    glGetIntegerv(GL_ACTIVE_TEXTURE, &active_texture);
+    detail::bindings().active_texture = static_cast<GLenum>(active_texture);
+
+#define GLSTATS_HOOK(fn) \
+    detail::real_##fn = glad_##fn; \
+    if (detail::real_##fn) glad_##fn = detail::counted_##fn;
+
+    GLSTATS_HOOK(glDrawArrays)
+    GLSTATS_HOOK(glDrawElements)
+    GLSTATS_HOOK(glDrawArraysInstanced)
+    GLSTATS_HOOK(glDrawElementsInstanced)
+    GLSTATS_HOOK(glUseProgram)
+    GLSTATS_HOOK(glBindTexture)
+    GLSTATS_HOOK(glActiveTexture)
+    GLSTATS_HOOK(glBindFramebuffer)
+    GLSTATS_HOOK(glBindVertexArray)
+    GLSTATS_HOOK(glEnable)
+    GLSTATS_HOOK(glDisable)
+    GLSTATS_HOOK(glBlendFunc)
+    GLSTATS_HOOK(glBlendFuncSeparate)
+    GLSTATS_HOOK(glBlendEquation)
+    GLSTATS_HOOK(glBlendEquationSeparate)
+    GLSTATS_HOOK(glDepthFunc)
+    GLSTATS_HOOK(glDepthMask)
+    GLSTATS_HOOK(glStencilFunc)
+    GLSTATS_HOOK(glStencilOp)
+    GLSTATS_HOOK(glStencilMask)
+#define GLSTATS_HOOK_UNIFORM(name, t, params, args) \
+    detail::real_gl##name##t = glad_gl##name##t; \
+    if (detail::real_gl##name##t) glad_gl##name##t = detail::counted_gl##name##t;
+    GLSTATS_UNIFORM_FUNCTIONS(GLSTATS_HOOK_UNIFORM)
+#undef GLSTATS_HOOK_UNIFORM
+    GLSTATS_HOOK(glBufferData)
+    GLSTATS_HOOK(glBufferSubData)
+    GLSTATS_HOOK(glMapBufferRange)
+    GLSTATS_HOOK(glFlushMappedBufferRange)
+    GLSTATS_HOOK(glBindBuffer)
+    GLSTATS_HOOK(glBindBufferBase)
+    GLSTATS_HOOK(glBindBufferRange)
+    GLSTATS_HOOK(glGenBuffers)
+    GLSTATS_HOOK(glDeleteBuffers)
+    GLSTATS_HOOK(glGenTextures)
+    GLSTATS_HOOK(glDeleteTextures)
+    GLSTATS_HOOK(glGenRenderbuffers)
+    GLSTATS_HOOK(glDeleteRenderbuffers)
+    GLSTATS_HOOK(glGenFramebuffers)
+    GLSTATS_HOOK(glDeleteFramebuffers)
+    GLSTATS_HOOK(glGenVertexArrays)
+    GLSTATS_HOOK(glDeleteVertexArrays)
+    GLSTATS_HOOK(glCreateProgram)
+    GLSTATS_HOOK(glDeleteProgram)
+    GLSTATS_HOOK(glTexImage2D)
+    GLSTATS_HOOK(glTexStorage2D)
+    GLSTATS_HOOK(glGenerateMipmap)
+    GLSTATS_HOOK(glBindRenderbuffer)
+    GLSTATS_HOOK(glRenderbufferStorage)
+
+#undef GLSTATS_HOOK
+#undef GLSTATS_UNIFORM_FUNCTIONS
+#undef GLSTATS_UNIFORM_MATRICES
+#undef GLSTATS_UNIFORM_MATRIX
+#undef GLSTATS_UNIFORM_VALUES
+
+    detail::installed() = true;
+}
+
+/**
+ * @brief Live objects and storage created through the wrappers since install().
+ */
+inline Resources resources() {
+    const detail::Tracker& t = detail::tracker();
+    Resources r;
+    r.buffers = t.buffers.size();
+    r.textures = t.textures.size();
+    r.renderbuffers = t.renderbuffers.size();
+    r.framebuffers = t.framebuffers.size();
+    r.vertex_arrays = t.vertex_arrays.size();
+    r.programs = t.programs.size();
+    for (const auto& buffer : t.buffers) r.buffer_bytes += buffer.second;
+    for (const auto& texture : t.textures) {
+        for (const auto& level : texture.second) r.texture_bytes += level.second.bytes();
+    }
+    for (const auto& renderbuffer : t.renderbuffers) r.renderbuffer_bytes += renderbuffer.second;
+    return r;
+}
+
+/// Writes @p c as a single-line JSON object.
+inline void writeJson(std::ostream& out, const Counters& c) {
+    const char* separator = "{";
+    forEachCounter(c, [&](const char* name, unsigned long long value) {
+        out << separator << "\"" << name << "\": " << value;
+        separator = ", ";
+    });
+    out << "}";
+}
+
+inline void writeJson(std::ostream& out, const Resources& r) {
+    const char* separator = "{";
+    forEachResource(r, [&](const char* name, unsigned long long value) {
+        out << separator << "\"" << name << "\": " << value;
+        separator = ", ";
+    });
+    out << "}";
+}
+
+/**
+ * @brief Writes Prometheus text exposition: one gauge per counter and resource.
+ *
+ * Counters are reported as given (typically the last frame), as
+ * <prefix>frame_<name>; resources as <prefix>live_<name>.
+ */
+inline void writePrometheus(std::ostream& out, const Counters& c, const Resources& r,
+                            const std::string& prefix = "engene_") {
+    auto gauge = [&](const std::string& name, unsigned long long value) {
+        out << "# TYPE " << prefix << name << " gauge\n"
+            << prefix << name << " " << value << "\n";
+    };
+    forEachCounter(c, [&](const char* name, unsigned long long value) {
+        gauge(std::string("frame_") + name, value);
+    });
+    forEachResource(r, [&](const char* name, unsigned long long value) {
+        gauge(std::string("live_") + name, value);
+    });
+}
+
+} // namespace glstats
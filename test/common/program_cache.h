@@ -0,0 +1,230 @@
+#pragma once
+
+#include <EnGene.h>
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief On-disk cache of linked GL program binaries.
+ *
+ * install() swaps glad's glLinkProgram pointer for a wrapper, the same way
+ * glstats does for its counters. When a program is linked, the wrapper
+ * hashes the driver identity (vendor, renderer, version) together with the
+ * sources of the attached shaders. On a hit it loads the stored binary with
+ * glProgramBinary instead of linking. On a miss, or when the driver rejects
+ * the stored binary (e.g. after a driver update), it links normally and
+ * saves the result of glGetProgramBinary for next time.
+ *
+ * Files are named by a 64-bit hash of the key, but each one also stores the
+ * full key, which is compared before the binary is handed to the driver. A
+ * hash collision or a stale entry is then treated like a rejected binary:
+ * the program is linked and the entry overwritten.
+ *
+ * Every shader::Shader, EnvironmentMapping and post-processing program
+ * created after install() goes through the cache without changes to
+ * CoreGene. Programs linked before install() (the EnGene base shader is
+ * linked in the constructor) are not cached. Shaders are still compiled;
+ * only the link step, where most drivers do their optimization, is skipped.
+ *
+ * State applied before linking that is not part of the shader sources
+ * (glBindAttribLocation, glTransformFeedbackVaryings) is not hashed, so a
+ * cache directory must not be shared between programs that differ only in
+ * that state.
+ *
+ * Must be called after the GL context is current and glad is loaded (e.g.
+ * at the start of on_initialize), before the shaders to cache are created.
+ *
+ * Usage:
+ * @code
+ * programcache::install("shader_cache");
+ * auto shader = shader::Shader::Make(vs, fs);
+ * std::cout << programcache::stats().hits << " programs loaded from cache\n";
+ * @endcode
+ */
+
+#ifndef APIENTRY
+#define APIENTRY
+#endif
+
+namespace programcache {
+
+struct Stats {
+    unsigned int hits = 0;       // loaded with glProgramBinary
+    unsigned int misses = 0;     // linked and stored
+    unsigned int rejected = 0;   // stored entry for another key or refused by the driver, relinked
+};
+
+inline Stats& stats() {
+    static Stats instance;
+    return instance;
+}
+
+namespace detail {
+
+constexpr char MAGIC[4] = {'C', 'G', 'P', 'B'};
+constexpr uint32_t FILE_VERSION = 2;   // 2: full key stored after the header
+
+inline PFNGLLINKPROGRAMPROC real_glLinkProgram = nullptr;
+
+inline std::string& directory() {
+    static std::string value;
+    return value;
+}
+
+inline uint64_t fnv1a(const std::string& data, uint64_t hash = 1469598103934665603ull) {
+    for (unsigned char c : data) {
+        hash ^= c;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+inline std::string glString(GLenum name) {
+    const GLubyte* value = glGetString(name);
+    return value ? reinterpret_cast<const char*>(value) : "";
+}
+
+// Driver identity plus every attached shader's stage and source, in stage order
+inline std::string programKey(GLuint program) {
+    std::string key = glString(GL_VENDOR) + '\n' + glString(GL_RENDERER) + '\n' + glString(GL_VERSION) + '\n';
+
+    GLint count = 0;
+    glGetProgramiv(program, GL_ATTACHED_SHADERS, &count);
+    std::vector<GLuint> shaders(count > 0 ? count : 0);
+    if (count > 0) glGetAttachedShaders(program, count, nullptr, shaders.data());
+
+    std::vector<std::pair<GLint, std::string>> stages;
+    for (GLuint shader : shaders) {
+        GLint type = 0, length = 0;
+        glGetShaderiv(shader, GL_SHADER_TYPE, &type);
+        glGetShaderiv(shader, GL_SHADER_SOURCE_LENGTH, &length);
+        std::string source(length > 0 ? length : 0, '\0');
+        if (length > 0) glGetShaderSource(shader, length, nullptr, &source[0]);
+        stages.emplace_back(type, std::move(source));
+    }
+    std::sort(stages.begin(), stages.end());
+
+    for (const auto& stage : stages) {
+        key += std::to_string(stage.first) + '\n' + stage.second + '\n';
+    }
+    return key;
+}
+
+inline std::string cachePath(uint64_t hash) {
+    static const char* digits = "0123456789abcdef";
+    std::string name(16, '0');
+    for (int i = 15; i >= 0; i--, hash >>= 4) name[i] = digits[hash & 0xf];
+    return (std::filesystem::path(directory()) / (name + ".bin")).string();
+}
+
+// File layout: MAGIC | FILE_VERSION | binary format | key length (uint64) | key | binary
+inline bool loadBinary(GLuint program, const std::string& path, const std::string& key) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) return false;
+
+    char magic[4];
+    uint32_t version = 0;
+    GLenum format = 0;
+    uint64_t key_length = 0;
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char*>(&version), sizeof(version));
+    file.read(reinterpret_cast<char*>(&format), sizeof(format));
+    file.read(reinterpret_cast<char*>(&key_length), sizeof(key_length));
+    if (!file || !std::equal(magic, magic + 4, MAGIC) || version != FILE_VERSION ||
+        key_length != key.size()) {
+        return false;
+    }
+
+    // Same hash is not enough: only the exact key identifies the program
+    std::string stored_key(key.size(), '\0');
+    file.read(&stored_key[0], static_cast<std::streamsize>(stored_key.size()));
+    if (!file || stored_key != key) return false;
+
+    std::vector<char> binary((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if (binary.empty()) return false;
+
+    glProgramBinary(program, format, binary.data(), static_cast<GLsizei>(binary.size()));
+    GLint linked = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &linked);
+    return linked == GL_TRUE;
+}
+
+inline void storeBinary(GLuint program, const std::string& path, const std::string& key) {
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) return;
+
+    std::vector<char> binary(length);
+    GLenum format = 0;
+    glGetProgramBinary(program, length, nullptr, &format, binary.data());
+
+    // Write to a temporary name first so a crash never leaves a truncated entry
+    std::string temp_path = path + ".tmp";
+    {
+        std::ofstream file(temp_path, std::ios::binary);
+        if (!file.is_open()) return;
+        uint64_t key_length = key.size();
+        file.write(MAGIC, sizeof(MAGIC));
+        file.write(reinterpret_cast<const char*>(&FILE_VERSION), sizeof(FILE_VERSION));
+        file.write(reinterpret_cast<const char*>(&format), sizeof(format));
+        file.write(reinterpret_cast<const char*>(&key_length), sizeof(key_length));
+        file.write(key.data(), static_cast<std::streamsize>(key.size()));
+        file.write(binary.data(), binary.size());
+        if (!file) return;
+    }
+    std::error_code error;
+    std::filesystem::rename(temp_path, path, error);
+}
+
+inline void APIENTRY cached_glLinkProgram(GLuint program) {
+    std::string key = programKey(program);
+    std::string path = cachePath(fnv1a(key));
+
+    if (loadBinary(program, path, key)) {
+        stats().hits++;
+        return;
+    }
+    if (std::filesystem::exists(path)) {
+        stats().rejected++;
+    } else {
+        stats().misses++;
+    }
+
+    glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    real_glLinkProgram(program);
+
+    GLint linked = GL_FALSE;
+    glGetProgramiv(program, GL_LINK_STATUS, &linked);
+    if (linked == GL_TRUE) storeBinary(program, path, key);
+}
+
+} // namespace detail
+
+/**
+ * @brief Routes glLinkProgram through the cache in @p directory (created if missing).
+ * @return false if the driver supports no program binary formats or the
+ *         directory cannot be created; programs then link as usual.
+ */
+inline bool install(const std::string& directory) {
+    if (detail::real_glLinkProgram) return true;
+
+    GLint formats = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+    if (formats <= 0 || !glad_glLinkProgram) return false;
+
+    std::error_code error;
+    std::filesystem::create_directories(directory, error);
+    if (error) return false;
+
+    detail::directory() = directory;
+    detail::real_glLinkProgram = glad_glLinkProgram;
+    glad_glLinkProgram = detail::cached_glLinkProgram;
+    return true;
+}
+
+} // namespace programcache
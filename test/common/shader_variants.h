@@ -0,0 +1,156 @@
+#pragma once
+
+#include <EnGene.h>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <regex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Program variants specialized at compile time on a feature mask.
+ *
+ * Shaders such as fragment_fog.glsl branch on flag uniforms (u_hasNormalMap
+ * and friends) that are constant for every node drawn with a given
+ * material. A VariantSet compiles one shader::Shader per feature mask
+ * instead, with the flags baked into the source: each Feature adds
+ * "#define MACRO 0|1" after the #version line, and, if it names a flag
+ * uniform, rewrites that "uniform bool name;" declaration into a
+ * "const bool name = true|false;". The GLSL compiler then drops the dead
+ * branches, and nothing has to be uploaded per draw. Shaders written
+ * against the macros can use #if directly; existing ones keep working
+ * unchanged through the uniform rewrite.
+ *
+ * A feature's uniform must be declared as a bool in at least one stage;
+ * the constructor throws otherwise, so a renamed flag cannot silently stay
+ * a runtime uniform that nothing sets.
+ *
+ * Masks are plain bit sets, one bit per Feature in constructor order, so
+ * the flags chosen for a node can be computed at run time (from the
+ * textures it is given) or fixed at compile time with variants::mask<>.
+ * Variants are built on first use and cached; pair with programcache to
+ * skip linking them again on the next run.
+ *
+ * Must be used after the GL context is current, and after anything the
+ * configure callback binds (e.g. the SceneLights UBO) exists.
+ *
+ * Usage:
+ * @code
+ * enum : variants::Mask { NORMAL_MAP = 1u << 0, DIFFUSE_MAP = 1u << 1 };
+ * variants::VariantSet set(
+ *     variants::readFile("shaders/lit.vert"), variants::readFile("shaders/lit.frag"),
+ *     {{"HAS_NORMAL_MAP", "u_hasNormalMap"}, {"HAS_DIFFUSE_MAP", "u_hasDiffuseMap"}},
+ *     [](const shader::ShaderPtr& s) { s->addResourceBlockToBind("CameraMatrices"); });
+ * auto plain = set.get<variants::mask<>>();
+ * auto textured = set.get(has_normal_map ? NORMAL_MAP : 0);
+ * @endcode
+ */
+namespace variants {
+
+using Mask = uint32_t;
+
+/// Compile-time union of feature bits, e.g. variants::mask<NORMAL_MAP, DIFFUSE_MAP>.
+template <Mask... Bits>
+constexpr Mask mask = (Mask(0) | ... | Bits);
+
+struct Feature {
+    std::string macro;      // defined to 1 or 0 in every stage
+    std::string uniform;    // flag uniform turned into a constant; empty for macro-only features
+};
+
+inline std::string readFile(const std::string& path) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        throw std::runtime_error("Failed to open shader file: " + path);
+    }
+    std::stringstream buffer;
+    buffer << file.rdbuf();
+    return buffer.str();
+}
+
+// Matches "uniform bool name;", with or without an initializer
+inline std::regex flagDeclaration(const std::string& uniform) {
+    return std::regex("uniform\\s+bool\\s+" + uniform + "\\s*(=[^;]*)?;");
+}
+
+/// Returns @p source with every feature of @p features resolved for @p mask.
+inline std::string specialize(const std::string& source, const std::vector<Feature>& features, Mask mask) {
+    std::string result = source;
+    std::string defines;
+    for (size_t i = 0; i < features.size(); i++) {
+        bool enabled = (mask >> i) & 1u;
+        defines += "#define " + features[i].macro + (enabled ? " 1\n" : " 0\n");
+        if (features[i].uniform.empty()) continue;
+
+        result = std::regex_replace(result, flagDeclaration(features[i].uniform),
+            "const bool " + features[i].uniform + (enabled ? " = true;" : " = false;"));
+    }
+
+    // #version must stay the first directive, so the defines go right after it
+    std::smatch version;
+    if (std::regex_search(result, version, std::regex("#version[^\\n]*\\n"))) {
+        result.insert(version.position(0) + version.length(0), defines);
+    } else {
+        result.insert(0, defines);
+    }
+    return result;
+}
+
+class VariantSet {
+public:
+    /// Called on each new variant before Bake(), for its blocks and uniforms.
+    using Configure = std::function<void(const shader::ShaderPtr&)>;
+
+    VariantSet(std::string vertex_source, std::string fragment_source,
+               std::vector<Feature> features, Configure configure)
+        : vertex_source_(std::move(vertex_source)), fragment_source_(std::move(fragment_source)),
+          features_(std::move(features)), configure_(std::move(configure)) {
+        if (features_.size() > 32) {
+            throw std::invalid_argument("VariantSet supports at most 32 features");
+        }
+        for (const auto& feature : features_) {
+            if (feature.uniform.empty()) continue;
+            std::regex declaration = flagDeclaration(feature.uniform);
+            if (!std::regex_search(vertex_source_, declaration) &&
+                !std::regex_search(fragment_source_, declaration)) {
+                throw std::invalid_argument("Feature " + feature.macro + ": no \"uniform bool " +
+                                            feature.uniform + ";\" in either shader stage");
+            }
+        }
+    }
+
+    /// The variant for @p mask, compiled on first request.
+    const shader::ShaderPtr& get(Mask mask) {
+        auto it = variants_.find(mask);
+        if (it != variants_.end()) return it->second;
+
+        auto shader = shader::Shader::Make(
+            specialize(vertex_source_, features_, mask),
+            specialize(fragment_source_, features_, mask));
+        if (configure_) configure_(shader);
+        shader->Bake();
+        return variants_.emplace(mask, shader).first->second;
+    }
+
+    template <Mask M>
+    const shader::ShaderPtr& get() {
+        return get(M);
+    }
+
+    /// Variants compiled so far.
+    size_t size() const { return variants_.size(); }
+
+private:
+    std::string vertex_source_;
+    std::string fragment_source_;
+    std::vector<Feature> features_;
+    Configure configure_;
+    std::map<Mask, shader::ShaderPtr> variants_;
+};
+
+} // namespace variants
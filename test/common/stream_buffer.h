@@ -0,0 +1,175 @@
+#pragma once
+
+#include <EnGene.h>
+#include <algorithm>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Ring of buffer segments for per-frame vertex streaming, with partial updates.
+ *
+ * geometry::Geometry copies its vertices into a GL buffer once, so content
+ * that changes every frame (cloth, particles, deforming meshes) would have
+ * to recreate its Geometry, reallocating the buffer and stalling on any draw
+ * still reading the old one. A RingBuffer allocates SEGMENTS copies of the
+ * data up front and draws from a different one each frame, so writing the
+ * next never waits on a draw still reading the last. fence() after the
+ * frame's draws marks when the GPU is done with a segment; only if the GPU
+ * falls a full ring behind does upload() block on that fence.
+ *
+ * Writes go to data(), a CPU copy of the whole buffer that always holds the
+ * newest contents, and flush() records which bytes changed. upload() then
+ * maps the current segment (GL_MAP_UNSYNCHRONIZED_BIT, explicit flushes)
+ * and copies in both this frame's ranges and those written while the
+ * segment was out of use, since it last held the data SEGMENTS frames ago.
+ * A small update therefore costs SEGMENTS small copies, not full rewrites;
+ * a segment that is rewritten whole is mapped with
+ * GL_MAP_INVALIDATE_RANGE_BIT instead. Draws read the current segment at
+ * offset() (e.g. glBindVertexBuffer with that offset), so the VAO layout
+ * is set up once.
+ *
+ * Uses only GL 4.3 core entry points (no ARB_buffer_storage), so it runs
+ * wherever EnGene does. Must be created after the GL context is current.
+ *
+ * Usage:
+ * @code
+ * stream::RingBuffer vertices(GL_ARRAY_BUFFER, vertex_count * sizeof(Vertex));
+ * // whenever vertices change (e.g. in on_update):
+ * auto* data = static_cast<Vertex*>(vertices.data());
+ * writeVertices(data + first, count);
+ * vertices.flush(first * sizeof(Vertex), count * sizeof(Vertex));
+ * // each frame:
+ * vertices.upload();
+ * glBindVertexBuffer(0, vertices.id(), vertices.offset(), sizeof(Vertex));
+ * glDrawElements(...);
+ * vertices.fence();
+ * @endcode
+ */
+namespace stream {
+
+class RingBuffer {
+public:
+    static constexpr int SEGMENTS = 3;
+
+    RingBuffer(GLenum target, GLsizeiptr segment_size)
+        : target_(target), segment_size_(segment_size), staging_(segment_size),
+          fences_(SEGMENTS, nullptr), pending_(SEGMENTS) {
+        glGenBuffers(1, &buffer_);
+        glBindBuffer(target_, buffer_);
+        glBufferData(target_, segment_size_ * SEGMENTS, nullptr, GL_STREAM_DRAW);
+        // Every segment starts undefined, so its first upload() copies everything
+        for (auto& ranges : pending_) ranges.push_back({0, segment_size_});
+    }
+
+    ~RingBuffer() {
+        for (GLsync fence : fences_) {
+            if (fence) glDeleteSync(fence);
+        }
+        glDeleteBuffers(1, &buffer_);
+    }
+
+    RingBuffer(const RingBuffer&) = delete;
+    RingBuffer& operator=(const RingBuffer&) = delete;
+
+    /// The newest contents, segmentSize() bytes; write here, then flush() what changed.
+    void* data() { return staging_.data(); }
+
+    /// Marks bytes [offset, offset + length) of data() as written.
+    void flush(GLintptr offset, GLsizeiptr length) {
+        GLintptr begin = std::max<GLintptr>(offset, 0);
+        GLintptr end = std::min<GLintptr>(offset + length, segment_size_);
+        if (begin >= end) return;
+        for (auto& ranges : pending_) addRange(ranges, begin, end);
+    }
+
+    /**
+     * @brief Brings the current segment up to date with data(); blocks only while the GPU still reads it.
+     * @return false if the segment could not be mapped; its ranges are retried next time round.
+     */
+    bool upload() {
+        auto& ranges = pending_[segment_];
+        if (ranges.empty()) return true;
+
+        waitForSegment();
+        GLintptr first = ranges.front().first;
+        GLintptr last = ranges.back().second;
+        GLbitfield access = GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_FLUSH_EXPLICIT_BIT;
+        if (ranges.size() == 1 && first == 0 && last == segment_size_) access |= GL_MAP_INVALIDATE_RANGE_BIT;
+
+        glBindBuffer(target_, buffer_);
+        auto* mapped = static_cast<unsigned char*>(
+            glMapBufferRange(target_, offset() + first, last - first, access));
+        if (!mapped) return false;
+        for (const auto& range : ranges) {
+            GLsizeiptr length = range.second - range.first;
+            std::memcpy(mapped + (range.first - first), staging_.data() + range.first, length);
+            glFlushMappedBufferRange(target_, range.first - first, length);
+            bytes_uploaded_ += static_cast<unsigned long long>(length);
+        }
+        glUnmapBuffer(target_);
+        ranges.clear();
+        return true;
+    }
+
+    /// Call after the last draw reading the current segment; moves to the next one.
+    void fence() {
+        fences_[segment_] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        segment_ = (segment_ + 1) % SEGMENTS;
+    }
+
+    GLuint id() const { return buffer_; }
+    GLintptr offset() const { return static_cast<GLintptr>(segment_) * segment_size_; }
+    GLsizeiptr segmentSize() const { return segment_size_; }
+
+    /// Times upload() had to wait for the GPU; nonzero means the ring is too short.
+    unsigned int stalls() const { return stalls_; }
+
+    /// Bytes copied into segments by upload() so far.
+    unsigned long long bytesUploaded() const { return bytes_uploaded_; }
+
+private:
+    using Range = std::pair<GLintptr, GLintptr>;    // [begin, end) in bytes
+
+    // Inserts [begin, end) keeping @p ranges sorted and merging anything it overlaps or touches
+    static void addRange(std::vector<Range>& ranges, GLintptr begin, GLintptr end) {
+        auto it = std::lower_bound(ranges.begin(), ranges.end(), Range{begin, end});
+        if (it != ranges.begin() && std::prev(it)->second >= begin) --it;
+        auto merged_end = it;
+        while (merged_end != ranges.end() && merged_end->first <= end) {
+            begin = std::min(begin, merged_end->first);
+            end = std::max(end, merged_end->second);
+            ++merged_end;
+        }
+        it = ranges.erase(it, merged_end);
+        ranges.insert(it, Range{begin, end});
+    }
+
+    void waitForSegment() {
+        GLsync& fence = fences_[segment_];
+        if (!fence) return;
+
+        GLenum status = glClientWaitSync(fence, 0, 0);
+        if (status != GL_ALREADY_SIGNALED && status != GL_CONDITION_SATISFIED) {
+            stalls_++;
+            const GLuint64 ONE_SECOND_NS = 1000000000ull;
+            do {
+                status = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, ONE_SECOND_NS);
+            } while (status == GL_TIMEOUT_EXPIRED);
+        }
+        glDeleteSync(fence);
+        fence = nullptr;
+    }
+
+    GLenum target_;
+    GLsizeiptr segment_size_;
+    GLuint buffer_ = 0;
+    int segment_ = 0;
+    std::vector<unsigned char> staging_;
+    std::vector<GLsync> fences_;
+    std::vector<std::vector<Range>> pending_;   // per segment: bytes newer than its contents
+    unsigned int stalls_ = 0;
+    unsigned long long bytes_uploaded_ = 0;
+};
+
+} // namespace stream
@@ -0,0 +1,165 @@
+#pragma once
+
+#include <EnGene.h>
+#include <algorithm>
+#include <vector>
+
+/**
+ * @brief Caps the resolution of uploaded textures to fit a smaller VRAM budget.
+ *
+ * install() swaps glad's glTexImage2D pointer for a wrapper, the same way
+ * glstats does for its counters. When a level 0 upload of 8-bit texels is
+ * larger than the limit on either side, the wrapper box-filters it down on
+ * the CPU, halving it until it fits, before the driver sees it. The texture
+ * then starts at what would have been a lower mip, and glGenerateMipmap
+ * builds the rest of the chain from there. Every 2D texture and cubemap
+ * face created after install() (Texture::Make, Cubemap::Make) is covered
+ * without changes to CoreGene: the top mips are simply never resident.
+ *
+ * Uploads the wrapper cannot resample safely pass through unchanged:
+ * mip levels other than 0, non-8-bit types, compressed or immutable
+ * storage, null data (render targets), and custom GL_UNPACK_ROW_LENGTH or
+ * skip settings. Code that later updates a clamped texture at its original
+ * size with glTexSubImage2D will fail, so install before loading assets
+ * rather than around dynamic textures.
+ *
+ * Must be called after the GL context is current and glad is loaded (e.g.
+ * at the start of on_initialize). When used with glstats, install it after
+ * glstats::install(): each wraps whatever glad_glTexImage2D holds, so the
+ * one installed last runs first, and only then does glstats see (and count
+ * as texture storage) the clamped size rather than the requested one.
+ *
+ * Usage:
+ * @code
+ * texbudget::install(1024);   // no texture larger than 1024 x 1024
+ * auto texture = texture::Texture::Make(4096, 4096, pixels);
+ * std::cout << texbudget::stats().bytes_saved << " bytes of VRAM saved\n";
+ * @endcode
+ */
+
+#ifndef APIENTRY
+#define APIENTRY
+#endif
+
+namespace texbudget {
+
+struct Stats {
+    unsigned int uploads = 0;           // level 0 uploads seen
+    unsigned int clamped = 0;           // uploads reduced to fit the limit
+    unsigned long long bytes_saved = 0; // level 0 bytes not uploaded
+};
+
+inline Stats& stats() {
+    static Stats instance;
+    return instance;
+}
+
+namespace detail {
+
+inline PFNGLTEXIMAGE2DPROC real_glTexImage2D = nullptr;
+inline GLsizei max_size = 0;
+
+inline int componentsFor(GLenum format) {
+    switch (format) {
+        case GL_RED: return 1;
+        case GL_RG: return 2;
+        case GL_RGB:
+        case GL_BGR: return 3;
+        case GL_RGBA:
+        case GL_BGRA: return 4;
+        default: return 0;
+    }
+}
+
+inline bool isColorTarget(GLenum target) {
+    return target == GL_TEXTURE_2D ||
+           (target >= GL_TEXTURE_CUBE_MAP_POSITIVE_X && target <= GL_TEXTURE_CUBE_MAP_NEGATIVE_Z);
+}
+
+inline bool defaultUnpackLayout() {
+    GLint row_length = 0, skip_rows = 0, skip_pixels = 0;
+    glGetIntegerv(GL_UNPACK_ROW_LENGTH, &row_length);
+    glGetIntegerv(GL_UNPACK_SKIP_ROWS, &skip_rows);
+    glGetIntegerv(GL_UNPACK_SKIP_PIXELS, &skip_pixels);
+    return row_length == 0 && skip_rows == 0 && skip_pixels == 0;
+}
+
+// 2x2 box filter; odd edges reuse the last row/column. Output rows are tightly packed.
+inline std::vector<unsigned char> halve(const unsigned char* src, GLsizei width, GLsizei height,
+                                        size_t src_stride, int components,
+                                        GLsizei& out_width, GLsizei& out_height) {
+    out_width = std::max(1, width / 2);
+    out_height = std::max(1, height / 2);
+    std::vector<unsigned char> dst(static_cast<size_t>(out_width) * out_height * components);
+
+    for (GLsizei y = 0; y < out_height; y++) {
+        const unsigned char* row0 = src + std::min(2 * y, height - 1) * src_stride;
+        const unsigned char* row1 = src + std::min(2 * y + 1, height - 1) * src_stride;
+        unsigned char* out = dst.data() + static_cast<size_t>(y) * out_width * components;
+        for (GLsizei x = 0; x < out_width; x++) {
+            GLsizei x0 = std::min(2 * x, width - 1) * components;
+            GLsizei x1 = std::min(2 * x + 1, width - 1) * components;
+            for (int c = 0; c < components; c++) {
+                unsigned sum = row0[x0 + c] + row0[x1 + c] + row1[x0 + c] + row1[x1 + c];
+                out[x * components + c] = static_cast<unsigned char>((sum + 2) / 4);
+            }
+        }
+    }
+    return dst;
+}
+
+inline void APIENTRY budget_glTexImage2D(GLenum target, GLint level, GLint internal_format,
+                                         GLsizei width, GLsizei height, GLint border,
+                                         GLenum format, GLenum type, const void* pixels) {
+    if (level == 0) stats().uploads++;
+
+    int components = componentsFor(format);
+    bool fits = width <= max_size && height <= max_size;
+    if (fits || level != 0 || !pixels || type != GL_UNSIGNED_BYTE || components == 0 ||
+        !isColorTarget(target) || !defaultUnpackLayout()) {
+        real_glTexImage2D(target, level, internal_format, width, height, border, format, type, pixels);
+        return;
+    }
+
+    GLint alignment = 4;
+    glGetIntegerv(GL_UNPACK_ALIGNMENT, &alignment);
+    size_t row_bytes = static_cast<size_t>(width) * components;
+    size_t stride = (row_bytes + alignment - 1) / alignment * alignment;
+
+    std::vector<unsigned char> data;
+    const unsigned char* src = static_cast<const unsigned char*>(pixels);
+    GLsizei w = width, h = height;
+    while (w > max_size || h > max_size) {
+        GLsizei half_w, half_h;
+        data = halve(src, w, h, stride, components, half_w, half_h);
+        w = half_w;
+        h = half_h;
+        src = data.data();
+        stride = static_cast<size_t>(w) * components;
+    }
+
+    stats().clamped++;
+    stats().bytes_saved += (static_cast<unsigned long long>(width) * height -
+                            static_cast<unsigned long long>(w) * h) * components;
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    real_glTexImage2D(target, level, internal_format, w, h, border, format, type, data.data());
+    glPixelStorei(GL_UNPACK_ALIGNMENT, alignment);
+}
+
+} // namespace detail
+
+/**
+ * @brief Limits textures uploaded from now on to @p max_size texels per side.
+ *
+ * Calling it again changes the limit; the hook is installed once.
+ */
+inline void install(GLsizei max_size) {
+    detail::max_size = std::max<GLsizei>(1, max_size);
+    if (detail::real_glTexImage2D || !glad_glTexImage2D) return;
+
+    detail::real_glTexImage2D = glad_glTexImage2D;
+    glad_glTexImage2D = detail::budget_glTexImage2D;
+}
+
+} // namespace texbudget
@@ -42,19 +42,22 @@ geometry::GeometryPtr g_cube_geom;
 geometry::GeometryPtr g_quad_geom;
 shader::ShaderPtr g_texture_shader;
 
+// Animated transform, kept here so updates don't look the node up by name
+std::shared_ptr<transform::Transform> g_cube_transform;
+
 /**
  * @brief Creates a simple fullscreen quad geometry for displaying textures.
  * 
- * Vertex format: position (vec3), texcoord (vec2)
+ * Vertex format: position (vec2, z = 0 from GL defaults), texcoord (vec2)
  */
 geometry::GeometryPtr createFullscreenQuad() {
-    // Fullscreen quad vertices: position (x, y, z) + texcoord (u, v)
+    // Fullscreen quad vertices: position (x, y) + texcoord (u, v)
     std::vector<float> vertices = {
-        // positions          // texcoords
-        -0.9f,  0.9f, 0.0f,   0.0f, 1.0f,  // top-left
-        -0.9f, -0.9f, 0.0f,   0.0f, 0.0f,  // bottom-left
-         0.9f, -0.9f, 0.0f,   1.0f, 0.0f,  // bottom-right
-         0.9f,  0.9f, 0.0f,   1.0f, 1.0f   // top-right
+        // positions    // texcoords
+        -0.9f,  0.9f,   0.0f, 1.0f,  // top-left
+        -0.9f, -0.9f,   0.0f, 0.0f,  // bottom-left
+         0.9f, -0.9f,   1.0f, 0.0f,  // bottom-right
+         0.9f,  0.9f,   1.0f, 1.0f   // top-right
     };
     
     std::vector<unsigned int> indices = {
@@ -67,7 +70,7 @@ geometry::GeometryPtr createFullscreenQuad() {
         indices.data(),
         4,  // 4 vertices
         6,  // 6 indices
-        3,  // 3 floats for position
+        2,  // 2 floats for position
         {2} // 2 floats for texcoord
     );
 }
@@ -171,11 +174,11 @@ int main() {
             .with<component::FramebufferComponent>(g_fbo);
         
         // Add rotating cube to off-screen scene
+        g_cube_transform = transform::Transform::Make();
+        g_cube_transform->setTranslate(0.0f, 0.0f, -5.0f);
+        
         offscreen_root.addNode("rotating_cube")
-            .with<component::TransformComponent>(
-                transform::Transform::Make()
-                    ->setTranslate(0.0f, 0.0f, -5.0f)
-            )
+            .with<component::TransformComponent>(g_cube_transform)
             .with<component::GeometryComponent>(g_cube_geom);
         
         std::cout << "✓ Off-screen scene created with FramebufferComponent" << std::endl;
@@ -202,21 +205,14 @@ int main() {
         // g_time += dt;
         
         // Update cube rotation
-        auto cube_node = scene::graph()->getNodeByName("rotating_cube");
-        if (cube_node) {
-            auto transform_comp = cube_node->payload().get<component::TransformComponent>();
-            if (transform_comp) {
-                auto transform = transform_comp->getTransform();
-                transform->rotate(
-                    static_cast<float>(dt*50),  // Rotate around Y axis
-                    0.0f, 1.0f, 0.0f
-                );
-                transform->rotate(
-                    static_cast<float>(dt * 30.0),  // Rotate around X axis
-                    1.0f, 0.0f, 0.0f
-                );
-            }
-        }
+        g_cube_transform->rotate(
+            static_cast<float>(dt * 50.0),  // Rotate around Y axis
+            0.0f, 1.0f, 0.0f
+        );
+        g_cube_transform->rotate(
+            static_cast<float>(dt * 30.0),  // Rotate around X axis
+            1.0f, 0.0f, 0.0f
+        );
     };
     
     auto on_render = [](double alpha) {
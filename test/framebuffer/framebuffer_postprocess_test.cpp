@@ -21,10 +21,10 @@
  * Test Structure:
  * 1. First pass: Render rotating cube to FBO (off-screen, with depth testing)
  * 2. Second pass: Apply grayscale post-processing effect to FBO texture
- * 3. Display processed result on fullscreen quad (on-screen)
+ * 3. Display processed result on a fullscreen triangle (on-screen)
  * 
  * Expected Result:
- * - Window displays a fullscreen quad with grayscale version of the cube
+ * - Window displays a grayscale version of the cube filling the screen
  * - Cube should be rotating and visible in grayscale with proper depth sorting
  * - No OpenGL errors
  * - Mipmaps generated successfully
@@ -37,40 +37,45 @@
 // Global state for animation and testing
 double g_time = 0.0;
 bool g_use_grayscale = true;
+bool g_pass_grayscale = true;   // Effect currently bound to the fullscreen pass
+
+// Animated transform, kept here so updates don't look the node up by name
+std::shared_ptr<transform::Transform> g_cube_transform;
 
 // Shared resources
 framebuffer::FramebufferPtr g_fbo;
 geometry::GeometryPtr g_cube_geom;
-geometry::GeometryPtr g_quad_geom;
+geometry::GeometryPtr g_fullscreen_geom;
 shader::ShaderPtr g_grayscale_shader;
 shader::ShaderPtr g_passthrough_shader;
 
 /**
- * @brief Creates a simple fullscreen quad geometry for displaying textures.
+ * @brief Creates a single triangle that covers the whole viewport.
+ * 
+ * One oversized triangle instead of a two-triangle quad: no diagonal edge
+ * where the 2x2 pixel blocks the GPU shades in are run by both triangles,
+ * and 3 vertices instead of 4. The parts outside clip space are clipped away; texcoords
+ * still run 0..1 across the visible area.
  * 
- * Vertex format: position (vec3), texcoord (vec2)
+ * Vertex format: position (vec2, z = 0 from GL defaults), texcoord (vec2)
  */
-geometry::GeometryPtr createFullscreenQuad() {
-    // Fullscreen quad vertices: position (x, y, z) + texcoord (u, v)
+geometry::GeometryPtr createFullscreenTriangle() {
+    // Fullscreen triangle vertices: position (x, y) + texcoord (u, v)
     std::vector<float> vertices = {
-        // positions          // texcoords
-        -1.0f,  1.0f, 0.0f,   0.0f, 1.0f,  // top-left
-        -1.0f, -1.0f, 0.0f,   0.0f, 0.0f,  // bottom-left
-         1.0f, -1.0f, 0.0f,   1.0f, 0.0f,  // bottom-right
-         1.0f,  1.0f, 0.0f,   1.0f, 1.0f   // top-right
+        // positions    // texcoords
+        -1.0f, -1.0f,   0.0f, 0.0f,  // bottom-left
+         3.0f, -1.0f,   2.0f, 0.0f,  // past bottom-right
+        -1.0f,  3.0f,   0.0f, 2.0f   // past top-left
     };
     
-    std::vector<unsigned int> indices = {
-        0, 1, 2,  // first triangle
-        0, 2, 3   // second triangle
-    };
+    std::vector<unsigned int> indices = {0, 1, 2};
     
     return geometry::Geometry::Make(
         vertices.data(), 
         indices.data(),
-        4,  // 4 vertices
-        6,  // 6 indices
-        3,  // 3 floats for position
+        3,  // 3 vertices
+        3,  // 3 indices
+        2,  // 2 floats for position
         {2} // 2 floats for texcoord
     );
 }
@@ -154,7 +159,7 @@ shader::ShaderPtr createPassthroughShader() {
 int main() {
     std::cout << "=== Framebuffer Post-Processing Test ===" << std::endl;
     std::cout << "Testing: Post-processing with grayscale effect" << std::endl;
-    std::cout << "Expected: Fullscreen quad displaying grayscale cube" << std::endl;
+    std::cout << "Expected: Fullscreen pass displaying grayscale cube" << std::endl;
     std::cout << "Controls: SPACE to toggle grayscale on/off" << std::endl;
     std::cout << std::endl;
     
@@ -191,9 +196,9 @@ int main() {
         g_cube_geom = Cube::Make(1.0f, 1.0f, 1.0f);
         std::cout << "✓ Cube geometry created" << std::endl;
         
-        // Create fullscreen quad for displaying FBO texture
-        g_quad_geom = createFullscreenQuad();
-        std::cout << "✓ Fullscreen quad created" << std::endl;
+        // Create fullscreen triangle for displaying FBO texture
+        g_fullscreen_geom = createFullscreenTriangle();
+        std::cout << "✓ Fullscreen triangle created" << std::endl;
         
         // Create post-processing shaders
         g_grayscale_shader = createGrayscaleShader();
@@ -225,23 +230,23 @@ int main() {
             .with<component::FramebufferComponent>(g_fbo);
         
         // Add rotating cube to off-screen scene
+        g_cube_transform = transform::Transform::Make();
+        g_cube_transform->setTranslate(0.0f, 0.0f, -5.0f);
+        
         offscreen_root.addNode("rotating_cube")
-            .with<component::TransformComponent>(
-                transform::Transform::Make()
-                    ->setTranslate(0.0f, 0.0f, -5.0f)
-            )
+            .with<component::TransformComponent>(g_cube_transform)
             .with<component::GeometryComponent>(g_cube_geom);
         
         std::cout << "✓ Off-screen scene created" << std::endl;
         
         // Create on-screen scene (renders to default framebuffer)
-        // Displays the FBO texture with post-processing on a fullscreen quad
+        // Displays the FBO texture with post-processing on a fullscreen triangle
         auto fbo_texture = g_fbo->getTexture("post_color");
         
-        scene::graph()->addNode("fullscreen_quad")
+        scene::graph()->addNode("fullscreen_pass")
             .with<component::ShaderComponent>(g_grayscale_shader)
             .with<component::TextureComponent>(fbo_texture, "u_scene_texture", 0)
-            .with<component::GeometryComponent>(g_quad_geom);
+            .with<component::GeometryComponent>(g_fullscreen_geom);
         
         std::cout << "✓ On-screen scene created with post-processing" << std::endl;
         
@@ -260,31 +265,23 @@ int main() {
         g_time += dt;
         
         // Update cube rotation
-        auto cube_node = scene::graph()->getNodeByName("rotating_cube");
-        if (cube_node) {
-            auto transform_comp = cube_node->payload().get<component::TransformComponent>();
-            if (transform_comp) {
-                auto transform = transform_comp->getTransform();
-                transform->rotate(
-                    static_cast<float>(dt * 50.0),  // Rotate around Y axis
-                    0.0f, 1.0f, 0.0f
-                );
-                transform->rotate(
-                    static_cast<float>(dt * 30.0),  // Rotate around X axis
-                    1.0f, 0.0f, 0.0f
-                );
-            }
-        }
-        
-        // Toggle shader based on user input
-        auto quad_node = scene::graph()->getNodeByName("fullscreen_quad");
-        if (quad_node) {
-            auto shader_comp = quad_node->payload().get<component::ShaderComponent>();
-            if (shader_comp) {
-                if (g_use_grayscale) {
-                    shader_comp->setShader(g_grayscale_shader);
-                } else {
-                    shader_comp->setShader(g_passthrough_shader);
+        g_cube_transform->rotate(
+            static_cast<float>(dt * 50.0),  // Rotate around Y axis
+            0.0f, 1.0f, 0.0f
+        );
+        g_cube_transform->rotate(
+            static_cast<float>(dt * 30.0),  // Rotate around X axis
+            1.0f, 0.0f, 0.0f
+        );
+        
+        // Swap the fullscreen pass's shader only when the user toggled the effect
+        if (g_use_grayscale != g_pass_grayscale) {
+            auto pass_node = scene::graph()->getNodeByName("fullscreen_pass");
+            if (pass_node) {
+                auto shader_comp = pass_node->payload().get<component::ShaderComponent>();
+                if (shader_comp) {
+                    shader_comp->setShader(g_use_grayscale ? g_grayscale_shader : g_passthrough_shader);
+                    g_pass_grayscale = g_use_grayscale;
                 }
             }
         }
@@ -294,11 +291,25 @@ int main() {
         // Clear default framebuffer
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
         
+        // The offscreen depth is invalidated at the end of every frame, so its
+        // contents are undefined here: clear it before the cube pass tests against it
+        framebuffer::stack()->push(g_fbo);
+        glClear(GL_DEPTH_BUFFER_BIT);
+        framebuffer::stack()->pop();
+        
         // Draw scene (includes both off-screen and on-screen passes)
         // 1. Off-screen pass: FramebufferComponent pushes FBO, renders cube, pops FBO
-        // 2. On-screen pass: Renders fullscreen quad with post-processed FBO texture
+        // 2. On-screen pass: Renders fullscreen triangle with post-processed FBO texture
         scene::graph()->draw();
         
+        // The offscreen depth buffer is dead once the cube pass is done. This
+        // saves no memory (the renderbuffer stays allocated); it tells the
+        // driver the contents need not be written back, which tiled GPUs skip
+        static const GLenum transient_attachments[] = {GL_DEPTH_ATTACHMENT};
+        framebuffer::stack()->push(g_fbo);
+        glInvalidateFramebuffer(GL_FRAMEBUFFER, 1, transient_attachments);
+        framebuffer::stack()->pop();
+        
         GL_CHECK("render");
     };
     
@@ -333,6 +344,7 @@ int main() {
         std::cout << "  ✓ Multi-pass rendering with post-processing" << std::endl;
         std::cout << "  ✓ Grayscale post-processing effect" << std::endl;
         std::cout << "  ✓ Proper depth testing during off-screen rendering" << std::endl;
+        std::cout << "  ✓ Off-screen depth cleared per frame, invalidated after its pass" << std::endl;
         std::cout << std::endl;
         
         app.run();
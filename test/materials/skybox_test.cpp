@@ -9,6 +9,7 @@
 #include <other_genes/environment_mapping.h>
 #include <other_genes/3d_shapes/sphere.h>
 #include <other_genes/input_handlers/arcball_input_handler.h>
+#include "../common/program_cache.h"
 
 /**
  * @brief Comprehensive integration test for skybox and environment mapping.
@@ -46,49 +47,22 @@ int main() {
     std::shared_ptr<arcball::ArcBallController> arcball_handler;
     
     auto on_init = [&](engene::EnGene& app) {
-        // Create procedural cubemap
-        std::cout << "[INIT] Creating procedural cubemap..." << std::endl;
-        const int face_size = 512;
-        std::array<unsigned char*, 6> face_data;
-        
-        // Generate colorful environment
-        for (int i = 0; i < 6; i++) {
-            face_data[i] = new unsigned char[face_size * face_size * 3];
-            
-            for (int y = 0; y < face_size; y++) {
-                for (int x = 0; x < face_size; x++) {
-                    int idx = (y * face_size + x) * 3;
-                    
-                    // Create gradient patterns
-                    float gradient_x = static_cast<float>(x) / face_size;
-                    float gradient_y = static_cast<float>(y) / face_size;
-                    
-                    unsigned char r = (i == 0 || i == 1) ? static_cast<unsigned char>(255 * gradient_x) : 80;
-                    unsigned char g = (i == 2 || i == 3) ? static_cast<unsigned char>(255 * gradient_y) : 80;
-                    unsigned char b = (i == 4 || i == 5) ? static_cast<unsigned char>(255 * (1.0f - gradient_x)) : 80;
-                    
-                    face_data[i][idx + 0] = r;
-                    face_data[i][idx + 1] = g;
-                    face_data[i][idx + 2] = b;
-                }
-            }
+        // Link the environment mapping programs from cached binaries when possible
+        if (programcache::install("shader_cache")) {
+            std::cout << "✓ Program binary cache enabled (shader_cache/)" << std::endl;
+        } else {
+            std::cout << "  Program binaries not supported, linking from source" << std::endl;
         }
-        
+
+        // Load cubemap (cross-layout PNG, decoded and uploaded by Cubemap::Make)
+        std::cout << "[INIT] Loading cubemap..." << std::endl;
         try {
-            // cubemap = texture::Cubemap::Make(face_size, face_size, face_data);
             cubemap = texture::Cubemap::Make("test/materials/skytest.png");
             std::cout << "✓ Cubemap created successfully" << std::endl;
         } catch (const std::exception& e) {
             std::cerr << "✗ Failed to create cubemap: " << e.what() << std::endl;
-            for (int i = 0; i < 6; i++) {
-                delete[] face_data[i];
-            }
             throw;
         }
-        
-        for (int i = 0; i < 6; i++) {
-            delete[] face_data[i];
-        }
 
         // Create multiple environment mapping systems with different configurations
         environment::EnvironmentMappingConfig config1;
@@ -120,7 +94,9 @@ int main() {
         config4.base_color = glm::vec3(0.8f, 0.8f, 0.2f);
         env_mapping4 = std::make_shared<environment::EnvironmentMapping>(config4);
         
-        std::cout << "✓ Environment mapping systems created" << std::endl;
+        std::cout << "✓ Environment mapping systems created ("
+                  << programcache::stats().hits << " programs from cache, "
+                  << programcache::stats().misses + programcache::stats().rejected << " linked)" << std::endl;
         std::cout << "[INIT] Setting up scene..." << std::endl;
         
         // Add skybox
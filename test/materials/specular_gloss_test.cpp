@@ -2,6 +2,7 @@
 #include <core/scene_node_builder.h>
 #include <components/all.h>
 #include <gl_base/error.h>
+#include <gl_base/framebuffer.h>
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -93,9 +94,12 @@ geometry::GeometryPtr createSphere(float radius, int sectors, int stacks) {
 
 int main() {
     try {
-        auto on_initialize = [](engene::EnGene& app) {
+        // Orbit transform (created in on_initialize, animated in on_fixed_update)
+        std::shared_ptr<transform::Transform> orbit_transform;
+
+        auto on_initialize = [&](engene::EnGene& app) {
             // Enable depth testing
-            glEnable(GL_DEPTH_TEST);
+            framebuffer::stack()->depth().setTest(true);
             
             // Load shaders
             auto vs_source = readShaderSource("core_gene/shaders/specular_gloss_vertex.glsl");
@@ -146,7 +150,7 @@ int main() {
                 .with<component::LightComponent>(light, light_transform);
 
             // Create orbit node that will rotate around the origin
-            auto orbit_transform = transform::Transform::Make();
+            orbit_transform = transform::Transform::Make();
             
             scene::graph()->addNode("OrbitNode")
                 .with<component::TransformComponent>(orbit_transform);
@@ -173,14 +177,11 @@ int main() {
             scene::graph()->getActiveCamera()->setAspectRatio(1.0f);
         };
 
-        auto on_fixed_update = [](double dt) {
+        auto on_fixed_update = [&](double dt) {
             // Rotate the orbit node to make the sphere orbit around the center
-            if (auto orbit = scene::graph()->getNodeByName("OrbitNode")) {
-                auto transform_component = orbit->payload().get<component::TransformComponent>();
-                if (transform_component) {
-                    // Rotate 30 degrees per second around Y axis
-                    transform_component->getTransform()->rotate(30.0f * (float)dt, 0, 1, 0);
-                }
+            if (orbit_transform) {
+                // Rotate 30 degrees per second around Y axis
+                orbit_transform->rotate(30.0f * (float)dt, 0, 1, 0);
             }
         };
 
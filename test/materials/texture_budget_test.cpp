@@ -0,0 +1,199 @@
+#include <iostream>
+#include <vector>
+#include <EnGene.h>
+#include <core/scene_node_builder.h>
+#include <components/all.h>
+#include <gl_base/error.h>
+#include <3d/camera/perspective_camera.h>
+#include "../common/texture_budget.h"
+
+/**
+ * @brief Texture budget test: the same texture uploaded with and without a size cap.
+ *
+ * A TEXTURE_SIZE x TEXTURE_SIZE procedural texture is created twice. The
+ * first copy is uploaded as is; the second after texbudget::install(), so
+ * it arrives at the driver box-filtered down to SIZE_LIMIT per side. Both
+ * are shown side by side on screen-space quads.
+ *
+ * This test validates:
+ * - texbudget::install() hook on glTexImage2D
+ * - Texture::Make uploads above the limit are reduced to fit
+ * - Uploads at or below the limit are left untouched
+ * - Budget statistics (clamped uploads, bytes saved)
+ *
+ * Expected Result:
+ * - Left quad: full-resolution checker with a color gradient
+ * - Right quad: the same image, visibly softer (SIZE_LIMIT texels)
+ * - "Texture budget saved N KB" printed at startup
+ * - No OpenGL errors
+ *
+ * Controls:
+ * - ESC: Exit
+ */
+
+const int TEXTURE_SIZE = 1024;
+const int SIZE_LIMIT = 256;
+const int SMALL_TEXTURE_SIZE = 64;     // Below the limit, must pass through
+const int CHECKER_CELL = 8;            // Texels per checker square
+
+/**
+ * @brief Creates a screen-space quad between x0 and x1 (NDC).
+ *
+ * Vertex format: position (vec2), texcoord (vec2)
+ */
+geometry::GeometryPtr createQuad(float x0, float x1) {
+    std::vector<float> vertices = {
+        // positions   // texcoords
+        x0,  0.6f,     0.0f, 1.0f,  // top-left
+        x0, -0.6f,     0.0f, 0.0f,  // bottom-left
+        x1, -0.6f,     1.0f, 0.0f,  // bottom-right
+        x1,  0.6f,     1.0f, 1.0f   // top-right
+    };
+
+    std::vector<unsigned int> indices = {
+        0, 1, 2,
+        0, 2, 3
+    };
+
+    return geometry::Geometry::Make(vertices.data(), indices.data(), 4, 6, 2, {2});
+}
+
+/**
+ * @brief Creates a simple texture display shader.
+ */
+shader::ShaderPtr createTextureShader() {
+    const char* vertex_source = R"(
+        #version 410 core
+        layout(location = 0) in vec3 a_position;
+        layout(location = 1) in vec2 a_texcoord;
+
+        out vec2 v_texcoord;
+
+        void main() {
+            gl_Position = vec4(a_position, 1.0);
+            v_texcoord = a_texcoord;
+        }
+    )";
+
+    const char* fragment_source = R"(
+        #version 410 core
+        in vec2 v_texcoord;
+        out vec4 FragColor;
+
+        uniform sampler2D u_texture;
+
+        void main() {
+            FragColor = texture(u_texture, v_texcoord);
+        }
+    )";
+
+    return shader::Shader::Make(vertex_source, fragment_source);
+}
+
+/**
+ * @brief RGBA checker modulated by a red/green gradient, so detail loss is visible.
+ */
+std::vector<unsigned char> createCheckerPixels(int size) {
+    std::vector<unsigned char> pixels(size * size * 4);
+    for (int y = 0; y < size; ++y) {
+        for (int x = 0; x < size; ++x) {
+            int idx = (y * size + x) * 4;
+            bool is_light = ((x / CHECKER_CELL) + (y / CHECKER_CELL)) % 2 == 0;
+            unsigned char base = is_light ? 255 : 40;
+            pixels[idx + 0] = static_cast<unsigned char>(base * x / size);
+            pixels[idx + 1] = static_cast<unsigned char>(base * y / size);
+            pixels[idx + 2] = base;
+            pixels[idx + 3] = 255;
+        }
+    }
+    return pixels;
+}
+
+int main() {
+    std::cout << "=== Texture Budget Test ===" << std::endl;
+    std::cout << "Testing: " << TEXTURE_SIZE << "x" << TEXTURE_SIZE << " texture with and without a "
+              << SIZE_LIMIT << " texel cap" << std::endl;
+    std::cout << "Expected: Left quad sharp, right quad the same image at lower resolution" << std::endl;
+    std::cout << std::endl;
+
+    auto on_init = [](engene::EnGene& app) {
+        std::cout << "[INIT] Creating textures..." << std::endl;
+
+        std::vector<unsigned char> pixels = createCheckerPixels(TEXTURE_SIZE);
+        auto full_texture = texture::Texture::Make(TEXTURE_SIZE, TEXTURE_SIZE, pixels.data());
+        std::cout << "✓ Full-resolution texture created" << std::endl;
+
+        texbudget::install(SIZE_LIMIT);
+        auto capped_texture = texture::Texture::Make(TEXTURE_SIZE, TEXTURE_SIZE, pixels.data());
+
+        std::vector<unsigned char> small_pixels = createCheckerPixels(SMALL_TEXTURE_SIZE);
+        auto small_texture = texture::Texture::Make(SMALL_TEXTURE_SIZE, SMALL_TEXTURE_SIZE, small_pixels.data());
+
+        // One upload over the limit, one under it
+        const texbudget::Stats& stats = texbudget::stats();
+        unsigned long long expected_saved =
+            4ull * (TEXTURE_SIZE * TEXTURE_SIZE - SIZE_LIMIT * SIZE_LIMIT);
+        if (stats.clamped != 1 || stats.bytes_saved != expected_saved) {
+            throw exception::EnGeneException(
+                "Texture budget mismatch: " + std::to_string(stats.clamped) + " clamped, " +
+                std::to_string(stats.bytes_saved) + " bytes saved (expected 1, " +
+                std::to_string(expected_saved) + ")");
+        }
+        std::cout << "✓ Capped texture created (" << stats.uploads << " uploads, "
+                  << stats.clamped << " clamped)" << std::endl;
+        std::cout << "✓ Texture budget saved " << stats.bytes_saved / 1024 << " KB" << std::endl;
+
+        auto texture_shader = createTextureShader();
+        texture_shader->configureDynamicUniform<uniform::detail::Sampler>(
+            "u_texture",
+            texture::getSamplerProvider("u_texture")
+        );
+        std::cout << "✓ Texture shader created" << std::endl;
+
+        auto& quads = scene::graph()->addNode("quads")
+            .with<component::ShaderComponent>(texture_shader);
+        quads.addNode("full_quad")
+            .with<component::TextureComponent>(full_texture, "u_texture", 0)
+            .with<component::GeometryComponent>(createQuad(-0.95f, -0.05f));
+        quads.addNode("capped_quad")
+            .with<component::TextureComponent>(capped_texture, "u_texture", 0)
+            .with<component::GeometryComponent>(createQuad(0.05f, 0.95f));
+
+        auto camera = component::PerspectiveCamera::Make(60.0f, 0.1f, 100.0f);
+        scene::graph()->setActiveCamera(camera);
+
+        std::cout << "[INIT] Initialization complete!" << std::endl;
+    };
+
+    auto on_update = [](double dt) {
+        // Static scene
+    };
+
+    auto on_render = [](double alpha) {
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        scene::graph()->draw();
+        GL_CHECK("render");
+    };
+
+    engene::EnGeneConfig config;
+    config.title = "Texture Budget Test - Capped Uploads";
+    config.width = 1280;
+    config.height = 720;
+    config.clearColor[0] = 0.1f;
+    config.clearColor[1] = 0.1f;
+    config.clearColor[2] = 0.15f;
+    config.clearColor[3] = 1.0f;
+
+    try {
+        engene::EnGene app(on_init, on_update, on_render, config);
+        std::cout << "\n[RUNNING] Texture budget test" << std::endl;
+        app.run();
+
+        std::cout << "\n✓ Test completed successfully!" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Test failed: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
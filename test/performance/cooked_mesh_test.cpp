@@ -0,0 +1,259 @@
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <EnGene.h>
+#include <core/scene_node_builder.h>
+#include <components/all.h>
+#include <gl_base/error.h>
+#include <gl_base/material.h>
+#include <3d/camera/perspective_camera.h>
+#include <other_genes/input_handlers/arcball_input_handler.h>
+#include "../common/cooked_mesh.h"
+
+/**
+ * @brief Cooked mesh test: binary mesh round trip through a memory mapping.
+ *
+ * Builds a large procedural terrain (position + normal), cooks it to
+ * COOKED_FILE in the system temp directory, then loads it back with
+ * cooked::load() and renders the loaded copy next to the in-memory original.
+ * The file is removed once loaded.
+ *
+ * This test validates:
+ * - cooked::write() layout and bounds
+ * - cooked::load() creating a Geometry straight from the mapped file
+ * - Header validation (rejects a non-mesh file)
+ * - Index validation (rejects a mesh with an out-of-range index)
+ * Either validation accepting its bad file fails the test.
+ *
+ * Expected Result:
+ * - Two identical terrain patches side by side
+ * - Console shows build, cook and load times (load should be far below build)
+ * - No OpenGL errors
+ *
+ * Controls:
+ * - Left Mouse Button + Drag: Rotate camera (orbit)
+ * - Mouse Wheel: Zoom in/out
+ * - ESC: Exit
+ */
+
+const int TERRAIN_CELLS = 512;          // TERRAIN_CELLS^2 quads
+const float TERRAIN_SIZE = 20.0f;
+const char* COOKED_FILE = "cooked_mesh_test.cgm";
+const char* NOT_A_MESH_FILE = "cooked_mesh_test_not_a_mesh.bin";
+
+double elapsedMs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief Writes a header-sized file with the wrong magic.
+ * @return true if cooked::load() refused it as "Not a cooked mesh", not for some other reason.
+ */
+bool rejectsNonMesh(const std::string& path) {
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        std::vector<char> junk(sizeof(cooked::Header), 'X');
+        file.write(junk.data(), junk.size());
+        if (!file) throw std::runtime_error("Failed to write " + path);
+    }
+
+    bool rejected = false;
+    try {
+        cooked::load(path);
+    } catch (const std::runtime_error& e) {
+        rejected = std::string(e.what()).find("Not a cooked mesh") != std::string::npos;
+        std::cout << (rejected ? "✓ Non-mesh file rejected (" : "✗ Non-mesh file rejected for the wrong reason (")
+                  << e.what() << ")" << std::endl;
+    }
+    std::filesystem::remove(path);
+    return rejected;
+}
+
+/**
+ * @brief Cooks a one-triangle mesh, then overwrites its last index with
+ * vertex_count. The result is structurally valid but must be rejected.
+ * @return true if cooked::load() refused the file for its index.
+ */
+bool rejectsOutOfRangeIndex(const std::string& path) {
+    const float vertices[] = {0.0f, 0.0f, 0.0f,  1.0f, 0.0f, 0.0f,  0.0f, 1.0f, 0.0f};
+    const unsigned int indices[] = {0, 1, 2};
+    if (!cooked::write(path, vertices, 3, indices, 3, 3, {})) {
+        throw std::runtime_error("Failed to write " + path);
+    }
+
+    uint32_t bad_index = 3;
+    {
+        std::fstream file(path, std::ios::in | std::ios::out | std::ios::binary);
+        cooked::Header header;
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        file.seekp(header.index_offset + 2 * sizeof(uint32_t));
+        file.write(reinterpret_cast<const char*>(&bad_index), sizeof(bad_index));
+    }
+
+    bool rejected = false;
+    try {
+        cooked::load(path);
+    } catch (const std::runtime_error& e) {
+        rejected = std::string(e.what()).find("out of range") != std::string::npos;
+        std::cout << (rejected ? "✓ Out-of-range index rejected (" : "✗ Out-of-range index rejected for the wrong reason (")
+                  << e.what() << ")" << std::endl;
+    }
+    std::filesystem::remove(path);
+    return rejected;
+}
+
+float terrainHeight(float x, float z) {
+    return 0.6f * std::sin(x * 0.8f) * std::cos(z * 0.6f) + 0.2f * std::sin(x * 3.1f + z * 2.3f);
+}
+
+int main() {
+    std::cout << "=== Cooked Mesh Test ===" << std::endl;
+    const std::string cooked_path = (std::filesystem::temp_directory_path() / COOKED_FILE).string();
+
+    std::cout << "Testing: " << (TERRAIN_CELLS + 1) * (TERRAIN_CELLS + 1)
+              << " vertex terrain cooked to " << cooked_path << " and memory-mapped back" << std::endl;
+    std::cout << std::endl;
+
+    auto* handler = new input::InputHandler();
+    std::shared_ptr<arcball::ArcBallController> arcball_handler;
+
+    auto on_init = [&](engene::EnGene& app) {
+        std::cout << "[INIT] Building terrain..." << std::endl;
+        auto start = std::chrono::steady_clock::now();
+
+        // Interleaved position (3) + normal (3)
+        const int side = TERRAIN_CELLS + 1;
+        std::vector<float> vertices;
+        std::vector<unsigned int> indices;
+        vertices.reserve(side * side * 6);
+        indices.reserve(TERRAIN_CELLS * TERRAIN_CELLS * 6);
+
+        float step = TERRAIN_SIZE / TERRAIN_CELLS;
+        for (int row = 0; row < side; row++) {
+            for (int col = 0; col < side; col++) {
+                float x = col * step - TERRAIN_SIZE * 0.5f;
+                float z = row * step - TERRAIN_SIZE * 0.5f;
+                float dx = terrainHeight(x + step, z) - terrainHeight(x - step, z);
+                float dz = terrainHeight(x, z + step) - terrainHeight(x, z - step);
+                glm::vec3 normal = glm::normalize(glm::vec3(-dx, 2.0f * step, -dz));
+
+                vertices.insert(vertices.end(), {x, terrainHeight(x, z), z, normal.x, normal.y, normal.z});
+            }
+        }
+        for (int row = 0; row < TERRAIN_CELLS; row++) {
+            for (int col = 0; col < TERRAIN_CELLS; col++) {
+                unsigned int i0 = row * side + col;
+                unsigned int i1 = i0 + 1;
+                unsigned int i2 = i0 + side;
+                unsigned int i3 = i2 + 1;
+                indices.insert(indices.end(), {i0, i2, i1, i1, i2, i3});
+            }
+        }
+
+        auto original = geometry::Geometry::Make(
+            vertices.data(), indices.data(),
+            vertices.size() / 6, indices.size(),
+            3, {3}
+        );
+        std::cout << "✓ Terrain built in " << elapsedMs(start) << " ms" << std::endl;
+
+        start = std::chrono::steady_clock::now();
+        if (!cooked::write(cooked_path, vertices.data(), vertices.size() / 6,
+                           indices.data(), indices.size(), 3, {3})) {
+            throw std::runtime_error("Failed to write " + cooked_path);
+        }
+        std::cout << "✓ Cooked to " << cooked_path << " in " << elapsedMs(start) << " ms" << std::endl;
+
+        start = std::chrono::steady_clock::now();
+        auto loaded = cooked::load(cooked_path);
+        std::cout << "✓ Loaded cooked mesh in " << elapsedMs(start) << " ms" << std::endl;
+
+        {
+            cooked::MappedFile file(cooked_path);
+            const cooked::Header& header = cooked::readHeader(file, cooked_path);
+            if (header.vertex_count != vertices.size() / 6 || header.index_count != indices.size()) {
+                throw std::runtime_error("Cooked mesh header does not match the source mesh");
+            }
+            std::cout << "✓ Header: " << header.vertex_count << " vertices, bounds y ["
+                      << header.bounds_min[1] << ", " << header.bounds_max[1] << "]" << std::endl;
+        }
+        std::filesystem::remove(cooked_path);
+
+        std::string not_a_mesh_path =
+            (std::filesystem::path(cooked_path).parent_path() / NOT_A_MESH_FILE).string();
+        if (!rejectsNonMesh(not_a_mesh_path)) {
+            throw std::runtime_error("Non-mesh file was not rejected by the magic check");
+        }
+        if (!rejectsOutOfRangeIndex(cooked_path)) {
+            throw std::runtime_error("Mesh with an out-of-range index was not rejected");
+        }
+
+        float offset = TERRAIN_SIZE * 0.55f;
+        scene::graph()->addNode("terrain_original")
+            .with<component::TransformComponent>(
+                transform::Transform::Make()->setTranslate(-offset, 0.0f, 0.0f))
+            .with<component::MaterialComponent>(material::Material::Make(glm::vec3(0.4f, 0.7f, 0.3f)))
+            .with<component::GeometryComponent>(original);
+
+        scene::graph()->addNode("terrain_cooked")
+            .with<component::TransformComponent>(
+                transform::Transform::Make()->setTranslate(offset, 0.0f, 0.0f))
+            .with<component::MaterialComponent>(material::Material::Make(glm::vec3(0.7f, 0.6f, 0.3f)))
+            .with<component::GeometryComponent>(loaded);
+
+        // Create camera looking down at both patches
+        auto camera = component::PerspectiveCamera::Make(60.0f, 0.1f, 200.0f);
+        camera->getTransform()->setTranslate(0.0f, TERRAIN_SIZE * 0.8f, TERRAIN_SIZE * 1.4f);
+        scene::graph()->setActiveCamera(camera);
+
+        // Configure shader with camera and material
+        auto base_shader = app.getBaseShader();
+        scene::graph()->getActiveCamera()->bindToShader(base_shader);
+        material::stack()->configureShaderDefaults(base_shader);
+        base_shader->Bake();
+
+        std::cout << "✓ Camera created" << std::endl;
+
+        // Attach arcball controls
+        arcball_handler = arcball::attachArcballTo(*handler);
+
+        std::cout << "✓ Arcball controller initialized" << std::endl;
+    };
+
+    auto on_update = [](double dt) {
+        // Static scene; arcball controller updates the camera
+    };
+
+    auto on_render = [](double alpha) {
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        scene::graph()->draw();
+        GL_CHECK("render");
+    };
+
+    engene::EnGeneConfig config;
+    config.title = "Cooked Mesh Test - Memory-Mapped Geometry";
+    config.width = 1280;
+    config.height = 720;
+    config.clearColor[0] = 0.1f;
+    config.clearColor[1] = 0.1f;
+    config.clearColor[2] = 0.15f;
+    config.clearColor[3] = 1.0f;
+
+    try {
+        engene::EnGene app(on_init, on_update, on_render, config, handler);
+        std::cout << "\n[RUNNING] Cooked mesh test" << std::endl;
+        app.run();
+
+        std::cout << "\n✓ Test completed successfully!" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Test failed: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,176 @@
+#include <iostream>
+#include <EnGene.h>
+#include <core/scene_node_builder.h>
+#include <components/all.h>
+#include <gl_base/error.h>
+#include <gl_base/material.h>
+#include <3d/camera/perspective_camera.h>
+#include <other_genes/3d_shapes/cube.h>
+#include <other_genes/input_handlers/arcball_input_handler.h>
+#include "../common/frame_profiler.h"
+#include "../common/gl_call_counter.h"
+#include "../common/frame_rate_report.h"
+
+/**
+ * @brief Draw-call stress test: thousands of nodes sharing one GeometryPtr.
+ *
+ * This test builds a flat grid of cube nodes that all reference the same
+ * geometry and one of a small palette of materials, so every node in a
+ * palette group is a candidate for instanced submission.
+ *
+ * This test validates:
+ * - Scene graph scaling with many sibling nodes
+ * - Geometry sharing across GeometryComponents
+ * - Material sharing across MaterialComponents
+ * - Per-node u_model upload through transform::current
+ * - glstats per-frame counters and live resource totals
+ *
+ * Expected Result:
+ * - A GRID_SIZE x GRID_SIZE field of colored cubes
+ * - Average frame time printed to the console every REPORT_INTERVAL seconds
+ * - No OpenGL errors
+ *
+ * Controls:
+ * - Left Mouse Button + Drag: Rotate camera (orbit)
+ * - Mouse Wheel: Zoom in/out
+ * - P: Print the last frame's profiler tree
+ * - T: Write the profiler history to TRACE_PATH (Chrome trace JSON)
+ * - S: Print last frame's GL counters and live GL resources (Prometheus text)
+ * - ESC: Exit
+ */
+
+const int GRID_SIZE = 64;              // GRID_SIZE^2 nodes
+const float GRID_SPACING = 1.5f;
+const double REPORT_INTERVAL = 2.0;    // Seconds between frame time reports
+const char* TRACE_PATH = "instancing_stress_trace.json";
+
+// Frame timing state
+framerate::Report g_frame_rate(REPORT_INTERVAL);
+
+// GL calls of the last complete frame, for the S key
+glstats::Counters g_last_frame_calls;
+
+int main() {
+    std::cout << "=== Instancing Stress Test ===" << std::endl;
+    std::cout << "Testing: " << GRID_SIZE * GRID_SIZE << " nodes sharing one cube geometry" << std::endl;
+    std::cout << std::endl;
+
+    auto* handler = new input::InputHandler();
+    std::shared_ptr<arcball::ArcBallController> arcball_handler;
+
+    profiler::recorder().setEnabled(true);
+    handler->registerCallback<input::InputType::KEY>(
+        [](KEY_HANDLER_ARGS) {
+            if (action != GLFW_PRESS) return;
+            if (key == GLFW_KEY_P && profiler::recorder().lastFrame()) {
+                profiler::recorder().printFrame(std::cout, *profiler::recorder().lastFrame());
+            } else if (key == GLFW_KEY_S) {
+                glstats::writePrometheus(std::cout, g_last_frame_calls, glstats::resources());
+            } else if (key == GLFW_KEY_T) {
+                if (profiler::recorder().writeChromeTrace(TRACE_PATH)) {
+                    std::cout << "✓ Trace written to " << TRACE_PATH << std::endl;
+                } else {
+                    std::cerr << "✗ Failed to write " << TRACE_PATH << std::endl;
+                }
+            }
+        }
+    );
+
+    auto on_init = [&](engene::EnGene& app) {
+        std::cout << "[INIT] Building cube grid..." << std::endl;
+
+        // Before any geometry is created, so the resource totals cover the whole scene
+        glstats::install();
+
+        // One geometry for every node in the grid
+        auto cube_geom = Cube::Make(1.0f, 1.0f, 1.0f);
+
+        // Small palette so nodes fall into a few geometry+material groups
+        std::vector<material::MaterialPtr> palette = {
+            material::Material::Make(glm::vec3(1.0f, 0.3f, 0.3f)),
+            material::Material::Make(glm::vec3(0.3f, 1.0f, 0.3f)),
+            material::Material::Make(glm::vec3(0.3f, 0.3f, 1.0f)),
+            material::Material::Make(glm::vec3(1.0f, 1.0f, 0.3f))
+        };
+
+        float half_extent = (GRID_SIZE - 1) * GRID_SPACING * 0.5f;
+        for (int x = 0; x < GRID_SIZE; x++) {
+            for (int z = 0; z < GRID_SIZE; z++) {
+                scene::graph()->addNode("cube_" + std::to_string(x) + "_" + std::to_string(z))
+                    .with<component::TransformComponent>(
+                        transform::Transform::Make()->setTranslate(
+                            x * GRID_SPACING - half_extent, 0.0f, z * GRID_SPACING - half_extent))
+                    .with<component::MaterialComponent>(palette[(x + z) % palette.size()])
+                    .with<component::GeometryComponent>(cube_geom);
+            }
+        }
+
+        std::cout << "✓ " << GRID_SIZE * GRID_SIZE << " cube nodes created (1 geometry, "
+                  << palette.size() << " materials)" << std::endl;
+
+        // Create camera looking down at the grid
+        auto camera = component::PerspectiveCamera::Make(60.0f, 0.1f, 500.0f);
+        camera->getTransform()->setTranslate(0.0f, half_extent, half_extent * 1.5f);
+        scene::graph()->setActiveCamera(camera);
+
+        // Configure shader with camera and material
+        auto base_shader = app.getBaseShader();
+        scene::graph()->getActiveCamera()->bindToShader(base_shader);
+        material::stack()->configureShaderDefaults(base_shader);
+        base_shader->Bake();
+
+        std::cout << "✓ Camera created" << std::endl;
+
+        // Attach arcball controls
+        arcball_handler = arcball::attachArcballTo(*handler);
+
+        std::cout << "✓ Arcball controller initialized" << std::endl;
+
+        g_frame_rate.start();
+    };
+
+    auto on_update = [](double dt) {
+        profiler::Scope update_scope("fixed_update");
+        // Static scene; arcball controller updates the camera
+    };
+
+    auto on_render = [](double alpha) {
+        // Frame boundary: everything since the last render (updates, swap) belongs to the previous frame
+        profiler::recorder().newFrame();
+        g_last_frame_calls = glstats::counters();
+        glstats::reset();
+        profiler::Scope render_scope("render");
+
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        {
+            profiler::Scope draw_scope("scene_draw", true);
+            scene::graph()->draw();
+        }
+        GL_CHECK("render");
+
+        // Report average frame time periodically
+        g_frame_rate.frame();
+    };
+
+    engene::EnGeneConfig config;
+    config.title = "Instancing Stress Test - Shared Geometry";
+    config.width = 1280;
+    config.height = 720;
+    config.clearColor[0] = 0.1f;
+    config.clearColor[1] = 0.1f;
+    config.clearColor[2] = 0.15f;
+    config.clearColor[3] = 1.0f;
+
+    try {
+        engene::EnGene app(on_init, on_update, on_render, config, handler);
+        std::cout << "\n[RUNNING] Instancing stress test" << std::endl;
+        app.run();
+
+        std::cout << "\n✓ Test completed successfully!" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Test failed: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,321 @@
+#include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include <EnGene.h>
+#include <core/scene_node_builder.h>
+#include <components/all.h>
+#include <gl_base/error.h>
+#include <gl_base/material.h>
+#include <3d/camera/perspective_camera.h>
+#include <other_genes/3d_shapes/cube.h>
+#include <other_genes/3d_shapes/sphere.h>
+#include <other_genes/input_handlers/arcball_input_handler.h>
+#include "../common/bvh.h"
+#include "../common/frame_rate_report.h"
+
+/**
+ * @brief Culling stress test: a world far larger than the camera frustum.
+ *
+ * Objects are spread over a square world and grouped into chunk nodes, so
+ * most individual nodes (and most whole chunks) lie outside the view at any
+ * time. This is the workload for per-node and per-subtree frustum culling.
+ *
+ * This test validates:
+ * - Scene graph scaling with many off-screen nodes
+ * - Chunked subtrees (group transform + local child offsets)
+ * - Mixed Cube and Sphere geometry under one camera
+ * - bvh::Tree ray, sphere and frustum queries over every object's world
+ *   bounds agree with a brute-force scan, and how much faster they are
+ * - The same queries still agree after the boxes move and the tree is refit
+ *
+ * Expected Result:
+ * - A field of cubes and spheres stretching past the far plane
+ * - "BVH queries match brute force" with both timings at startup
+ * - "Refit in ... ms; queries still match brute force"
+ * - Average frame time printed to the console every REPORT_INTERVAL seconds
+ * - No OpenGL errors
+ *
+ * Controls:
+ * - Left Mouse Button + Drag: Rotate camera (orbit)
+ * - Middle Mouse Button + Drag: Pan camera
+ * - Mouse Wheel: Zoom in/out
+ * - ESC: Exit
+ */
+
+const int CHUNKS_PER_SIDE = 16;        // CHUNKS_PER_SIDE^2 chunk nodes
+const int OBJECTS_PER_CHUNK = 32;
+const float CHUNK_SIZE = 25.0f;        // World units per chunk side
+const float CAMERA_FAR = 60.0f;        // Well below the world extent
+const double REPORT_INTERVAL = 2.0;    // Seconds between frame time reports
+const int BVH_QUERY_COUNT = 1000;      // Queries of each kind in the BVH check
+
+// Frame timing state
+framerate::Report g_frame_rate(REPORT_INTERVAL);
+
+// Random query set shared by the tree and brute-force passes
+struct BvhQueries {
+    std::vector<glm::vec3> origins, directions, centers;
+    float sphere_radius = 10.0f;
+    glm::vec4 planes[6];
+};
+
+/**
+ * @brief Runs @p queries against @p tree and by brute force over @p bounds.
+ * @return number of queries whose results differ.
+ */
+int compareBvhQueries(const bvh::Tree& tree, const std::vector<bvh::AABB>& bounds, const BvhQueries& queries,
+                      double& tree_ms, double& scan_ms, size_t& in_view) {
+    using clock = std::chrono::steady_clock;
+
+    std::vector<bvh::Hit> tree_hits(BVH_QUERY_COUNT);
+    std::vector<std::vector<int>> tree_spheres(BVH_QUERY_COUNT);
+    std::vector<int> tree_frustum;
+    auto tree_start = clock::now();
+    for (int i = 0; i < BVH_QUERY_COUNT; i++) {
+        tree_hits[i] = tree.raycast(queries.origins[i], queries.directions[i]);
+        tree.querySphere(queries.centers[i], queries.sphere_radius, tree_spheres[i]);
+    }
+    tree.queryFrustum(queries.planes, tree_frustum);
+    tree_ms = std::chrono::duration<double, std::milli>(clock::now() - tree_start).count();
+
+    std::vector<bvh::Hit> scan_hits(BVH_QUERY_COUNT);
+    std::vector<std::vector<int>> scan_spheres(BVH_QUERY_COUNT);
+    std::vector<int> scan_frustum;
+    auto scan_start = clock::now();
+    for (int i = 0; i < BVH_QUERY_COUNT; i++) {
+        glm::vec3 inv_direction = 1.0f / queries.directions[i];
+        for (size_t j = 0; j < bounds.size(); j++) {
+            float t = bvh::intersectRay(bounds[j], queries.origins[i], inv_direction, scan_hits[i].distance);
+            if (t >= 0.0f && t < scan_hits[i].distance) {
+                scan_hits[i].index = static_cast<int>(j);
+                scan_hits[i].distance = t;
+            }
+            if (bvh::intersectSphere(bounds[j], queries.centers[i], queries.sphere_radius)) {
+                scan_spheres[i].push_back(static_cast<int>(j));
+            }
+        }
+    }
+    for (size_t j = 0; j < bounds.size(); j++) {
+        if (bvh::intersectFrustum(bounds[j], queries.planes)) scan_frustum.push_back(static_cast<int>(j));
+    }
+    scan_ms = std::chrono::duration<double, std::milli>(clock::now() - scan_start).count();
+
+    // Traversal order differs, so compare result sets; ties at equal distance may pick either box
+    int mismatches = 0;
+    for (int i = 0; i < BVH_QUERY_COUNT; i++) {
+        if (tree_hits[i].distance != scan_hits[i].distance) mismatches++;
+        std::sort(tree_spheres[i].begin(), tree_spheres[i].end());
+        if (tree_spheres[i] != scan_spheres[i]) mismatches++;
+    }
+    std::sort(tree_frustum.begin(), tree_frustum.end());
+    if (tree_frustum != scan_frustum) mismatches++;
+
+    in_view = tree_frustum.size();
+    return mismatches;
+}
+
+/**
+ * @brief Runs the same random rays and sphere queries, plus one frustum
+ * query, against @p bounds through a bvh::Tree and by brute force; then
+ * moves every box, refits the tree and runs them again.
+ * @return true if every query returned the same objects both ways, before and after the refit.
+ */
+bool validateBvh(const std::vector<bvh::AABB>& bounds, float half_world, const glm::mat4& view_proj) {
+    using clock = std::chrono::steady_clock;
+
+    auto build_start = clock::now();
+    bvh::Tree tree;
+    tree.build(bounds);
+    double build_ms = std::chrono::duration<double, std::milli>(clock::now() - build_start).count();
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> position(-half_world, half_world);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+    // Picking-style rays from eye height, and proximity spheres on the ground
+    BvhQueries queries;
+    for (int i = 0; i < BVH_QUERY_COUNT; i++) {
+        float ox = position(rng), oz = position(rng);
+        float dx = unit(rng), dz = unit(rng);
+        float cx = position(rng), cz = position(rng);
+        queries.origins.push_back(glm::vec3(ox, 2.0f, oz));
+        queries.directions.push_back(glm::normalize(glm::vec3(dx, -0.2f, dz)));
+        queries.centers.push_back(glm::vec3(cx, 0.0f, cz));
+    }
+    bvh::frustumPlanes(view_proj, queries.planes);
+
+    double tree_ms = 0.0, scan_ms = 0.0;
+    size_t in_view = 0;
+    int mismatches = compareBvhQueries(tree, bounds, queries, tree_ms, scan_ms, in_view);
+
+    std::cout << "[INIT] BVH: " << tree.nodeCount() << " nodes over " << bounds.size()
+              << " objects, built in " << build_ms << " ms" << std::endl;
+    std::cout << "[INIT] " << BVH_QUERY_COUNT << " rays + " << BVH_QUERY_COUNT
+              << " sphere queries + 1 frustum query (" << in_view << " objects in view)" << std::endl;
+    if (mismatches > 0) {
+        std::cout << "✗ BVH queries differ from brute force in " << mismatches << " cases" << std::endl;
+        return false;
+    }
+    std::cout << "✓ BVH queries match brute force: " << tree_ms << " ms vs " << scan_ms << " ms" << std::endl;
+
+    // Scatter every box by up to a chunk, no longer where the tree was split for it
+    std::uniform_real_distribution<float> shift(-CHUNK_SIZE, CHUNK_SIZE);
+    std::vector<bvh::AABB> moved = bounds;
+    for (auto& box : moved) {
+        glm::vec3 delta(shift(rng), 0.0f, shift(rng));
+        box.min += delta;
+        box.max += delta;
+    }
+
+    auto refit_start = clock::now();
+    tree.refit(moved);
+    double refit_ms = std::chrono::duration<double, std::milli>(clock::now() - refit_start).count();
+
+    mismatches = compareBvhQueries(tree, moved, queries, tree_ms, scan_ms, in_view);
+    if (mismatches > 0) {
+        std::cout << "✗ Refit BVH queries differ from brute force in " << mismatches << " cases" << std::endl;
+        return false;
+    }
+    std::cout << "✓ Refit in " << refit_ms << " ms; queries still match brute force ("
+              << in_view << " objects in view)" << std::endl;
+    return true;
+}
+
+int main() {
+    std::cout << "=== Large World Test ===" << std::endl;
+    std::cout << "Testing: " << CHUNKS_PER_SIDE * CHUNKS_PER_SIDE * OBJECTS_PER_CHUNK
+              << " objects over a " << CHUNKS_PER_SIDE * CHUNK_SIZE << " unit world" << std::endl;
+    std::cout << "Controls:" << std::endl;
+    std::cout << "  Left Mouse + Drag: Rotate camera (orbit)" << std::endl;
+    std::cout << "  Middle Mouse + Drag: Pan camera" << std::endl;
+    std::cout << "  Mouse Wheel: Zoom in/out" << std::endl;
+    std::cout << "  ESC: Exit" << std::endl;
+    std::cout << std::endl;
+
+    auto* handler = new input::InputHandler();
+    std::shared_ptr<arcball::ArcBallController> arcball_handler;
+
+    auto on_init = [&](engene::EnGene& app) {
+        std::cout << "[INIT] Building world chunks..." << std::endl;
+
+        auto cube_geom = Cube::Make(1.0f, 1.0f, 1.0f);
+        auto sphere_geom = Sphere::Make(0.5f, 16, 32);
+
+        auto cube_material = material::Material::Make(glm::vec3(0.7f, 0.5f, 0.3f));
+        auto sphere_material = material::Material::Make(glm::vec3(0.3f, 0.6f, 0.8f));
+
+        // Fixed seed so every run builds the same world
+        std::mt19937 rng(1234);
+        std::uniform_real_distribution<float> offset(-0.5f * CHUNK_SIZE, 0.5f * CHUNK_SIZE);
+        std::uniform_real_distribution<float> size(0.5f, 2.5f);
+
+        // World bounds of every object, in creation order, for the BVH check
+        std::vector<bvh::AABB> object_bounds;
+
+        float half_world = CHUNKS_PER_SIDE * CHUNK_SIZE * 0.5f;
+        for (int cx = 0; cx < CHUNKS_PER_SIDE; cx++) {
+            for (int cz = 0; cz < CHUNKS_PER_SIDE; cz++) {
+                std::string chunk_name = "chunk_" + std::to_string(cx) + "_" + std::to_string(cz);
+                glm::vec3 chunk_center((cx + 0.5f) * CHUNK_SIZE - half_world, 0.0f,
+                                       (cz + 0.5f) * CHUNK_SIZE - half_world);
+
+                auto& chunk = scene::graph()->addNode(chunk_name)
+                    .with<component::TransformComponent>(
+                        transform::Transform::Make()->setTranslate(
+                            chunk_center.x, chunk_center.y, chunk_center.z));
+
+                for (int i = 0; i < OBJECTS_PER_CHUNK; i++) {
+                    float x = offset(rng);
+                    float z = offset(rng);
+                    float s = size(rng);
+                    bool is_cube = (i % 2) == 0;
+
+                    chunk.addNode(chunk_name + "_obj_" + std::to_string(i))
+                        .with<component::TransformComponent>(
+                            transform::Transform::Make()
+                                ->translate(x, 0.5f * s, z)
+                                ->scale(s, s, s))
+                        .with<component::MaterialComponent>(is_cube ? cube_material : sphere_material)
+                        .with<component::GeometryComponent>(is_cube ? cube_geom : sphere_geom);
+
+                    // Unit cube and 0.5 radius sphere both span half a unit per axis
+                    glm::vec3 center = chunk_center + glm::vec3(x, 0.5f * s, z);
+                    object_bounds.push_back(bvh::AABB{center - glm::vec3(0.5f * s), center + glm::vec3(0.5f * s)});
+                }
+            }
+        }
+
+        std::cout << "✓ " << CHUNKS_PER_SIDE * CHUNKS_PER_SIDE << " chunks created with "
+                  << OBJECTS_PER_CHUNK << " objects each" << std::endl;
+
+        // Create camera near the world center with a short far plane
+        auto camera = component::PerspectiveCamera::Make(60.0f, 0.1f, CAMERA_FAR);
+        glm::vec3 camera_position(0.0f, 8.0f, 20.0f);
+        camera->getTransform()->setTranslate(camera_position.x, camera_position.y, camera_position.z);
+        scene::graph()->setActiveCamera(camera);
+
+        // Configure shader with camera and material
+        auto base_shader = app.getBaseShader();
+        scene::graph()->getActiveCamera()->bindToShader(base_shader);
+        material::stack()->configureShaderDefaults(base_shader);
+        base_shader->Bake();
+
+        std::cout << "✓ Camera created (far plane " << CAMERA_FAR << ")" << std::endl;
+
+        // Reference frustum for the BVH check: camera_position looking at the
+        // world center, 60 degrees at the window's aspect. It is not read back
+        // from the camera (whose orientation is the engine's, then arcball's);
+        // the check only needs a realistic slice of the world
+        glm::mat4 view_proj =
+            glm::perspective(glm::radians(60.0f), 1280.0f / 720.0f, 0.1f, CAMERA_FAR) *
+            glm::lookAt(camera_position, glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+        if (!validateBvh(object_bounds, half_world, view_proj)) {
+            throw std::runtime_error("BVH validation failed");
+        }
+
+        // Attach arcball controls
+        arcball_handler = arcball::attachArcballTo(*handler);
+
+        std::cout << "✓ Arcball controller initialized" << std::endl;
+
+        g_frame_rate.start();
+    };
+
+    auto on_update = [](double dt) {
+        // Static world; arcball controller updates the camera
+    };
+
+    auto on_render = [](double alpha) {
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        scene::graph()->draw();
+        GL_CHECK("render");
+
+        // Report average frame time periodically
+        g_frame_rate.frame();
+    };
+
+    engene::EnGeneConfig config;
+    config.title = "Large World Test - Mostly Off-Screen Geometry";
+    config.width = 1280;
+    config.height = 720;
+    config.clearColor[0] = 0.1f;
+    config.clearColor[1] = 0.1f;
+    config.clearColor[2] = 0.15f;
+    config.clearColor[3] = 1.0f;
+
+    try {
+        engene::EnGene app(on_init, on_update, on_render, config, handler);
+        std::cout << "\n[RUNNING] Large world test" << std::endl;
+        app.run();
+
+        std::cout << "\n✓ Test completed successfully!" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Test failed: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
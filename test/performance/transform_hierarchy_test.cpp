@@ -0,0 +1,169 @@
+#include <iostream>
+#include <cmath>
+#include <EnGene.h>
+#include <core/scene_node_builder.h>
+#include <components/all.h>
+#include <gl_base/error.h>
+#include <gl_base/material.h>
+#include <gl_base/transform.h>
+#include <3d/camera/perspective_camera.h>
+#include <other_genes/3d_shapes/cube.h>
+#include <other_genes/input_handlers/arcball_input_handler.h>
+#include "../common/frame_rate_report.h"
+
+/**
+ * @brief Transform stress test: a deep static hierarchy under one moving root.
+ *
+ * Only the root transform changes each tick; every other TransformComponent
+ * in the tree is set once at initialization. This is the case where cached
+ * world matrices pay off, like the sphere under "OrbitNode" in
+ * specular_gloss_test.cpp, scaled up to 1555 nodes (1 + 6 + ... + 6^4).
+ *
+ * This test validates:
+ * - Hierarchical transform composition across HIERARCHY_DEPTH levels
+ * - Parent rotation propagating to every descendant
+ * - Scene graph scaling with deep (not just wide) trees
+ *
+ * Expected Result:
+ * - A fractal of cube rings rotating as one rigid body around the Y axis
+ * - Average frame time printed to the console every REPORT_INTERVAL seconds
+ * - No OpenGL errors
+ *
+ * Controls:
+ * - Left Mouse Button + Drag: Rotate camera (orbit)
+ * - Mouse Wheel: Zoom in/out
+ * - ESC: Exit
+ */
+
+const int HIERARCHY_DEPTH = 4;         // Levels below the root
+const int BRANCH_FACTOR = 6;           // Children per node
+const float BRANCH_RADIUS = 4.0f;      // Child distance in parent space
+const float BRANCH_SCALE = 0.35f;      // Child scale relative to parent
+// Leaf cube edge in leaf space: 60% of the sibling spacing (BRANCH_RADIUS in
+// the parent's space), so leaves stay visible after BRANCH_SCALE^HIERARCHY_DEPTH
+const float LEAF_CUBE_SIZE = 0.6f * BRANCH_RADIUS / BRANCH_SCALE;
+const double REPORT_INTERVAL = 2.0;    // Seconds between frame time reports
+
+// Root transform, cached so the update loop doesn't look it up by name
+std::shared_ptr<transform::Transform> g_root_transform;
+
+// Frame timing state
+framerate::Report g_frame_rate(REPORT_INTERVAL);
+int g_node_count = 0;
+
+/**
+ * @brief Recursively adds a ring of BRANCH_FACTOR children under parent.
+ *
+ * Inner levels are pure transform nodes; only the last level carries geometry.
+ */
+template <typename Builder>
+void buildRing(Builder& parent, const std::string& prefix, int depth,
+               const geometry::GeometryPtr& geom) {
+    const float PI = 3.14159265359f;
+
+    for (int i = 0; i < BRANCH_FACTOR; i++) {
+        float angle = 2.0f * PI * i / BRANCH_FACTOR;
+        std::string name = prefix + "_" + std::to_string(i);
+
+        auto& child = parent.addNode(name)
+            .template with<component::TransformComponent>(
+                transform::Transform::Make()
+                    ->translate(BRANCH_RADIUS * std::cos(angle), 0.0f, BRANCH_RADIUS * std::sin(angle))
+                    ->scale(BRANCH_SCALE, BRANCH_SCALE, BRANCH_SCALE));
+        g_node_count++;
+
+        if (depth == 1) {
+            child.template with<component::GeometryComponent>(geom);
+        } else {
+            buildRing(child, name, depth - 1, geom);
+        }
+    }
+}
+
+int main() {
+    std::cout << "=== Transform Hierarchy Stress Test ===" << std::endl;
+    std::cout << "Testing: static hierarchy (depth " << HIERARCHY_DEPTH << ", branch "
+              << BRANCH_FACTOR << ") under one rotating root" << std::endl;
+    std::cout << std::endl;
+
+    auto* handler = new input::InputHandler();
+    std::shared_ptr<arcball::ArcBallController> arcball_handler;
+
+    auto on_init = [&](engene::EnGene& app) {
+        std::cout << "[INIT] Building transform hierarchy..." << std::endl;
+
+        auto cube_geom = Cube::Make(LEAF_CUBE_SIZE, LEAF_CUBE_SIZE, LEAF_CUBE_SIZE);
+        auto material = material::Material::Make(glm::vec3(0.8f, 0.6f, 0.3f));
+
+        g_root_transform = transform::Transform::Make();
+
+        auto& root = scene::graph()->addNode("hierarchy_root")
+            .with<component::TransformComponent>(g_root_transform)
+            .with<component::MaterialComponent>(material);
+        g_node_count = 1;
+
+        buildRing(root, "branch", HIERARCHY_DEPTH, cube_geom);
+
+        std::cout << "✓ " << g_node_count << " nodes created ("
+                  << static_cast<int>(std::pow(BRANCH_FACTOR, HIERARCHY_DEPTH))
+                  << " leaf cubes)" << std::endl;
+
+        // Create camera
+        auto camera = component::PerspectiveCamera::Make(60.0f, 0.1f, 100.0f);
+        camera->getTransform()->setTranslate(0.0f, 6.0f, 10.0f);
+        scene::graph()->setActiveCamera(camera);
+
+        // Configure shader with camera and material
+        auto base_shader = app.getBaseShader();
+        scene::graph()->getActiveCamera()->bindToShader(base_shader);
+        material::stack()->configureShaderDefaults(base_shader);
+        base_shader->Bake();
+
+        std::cout << "✓ Camera created" << std::endl;
+
+        // Attach arcball controls
+        arcball_handler = arcball::attachArcballTo(*handler);
+
+        std::cout << "✓ Arcball controller initialized" << std::endl;
+
+        g_frame_rate.start();
+    };
+
+    auto on_update = [](double dt) {
+        // Only the root moves; the rest of the tree is static
+        if (g_root_transform) {
+            g_root_transform->rotate(20.0f * (float)dt, 0, 1, 0);
+        }
+    };
+
+    auto on_render = [](double alpha) {
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        scene::graph()->draw();
+        GL_CHECK("render");
+
+        // Report average frame time periodically
+        g_frame_rate.frame();
+    };
+
+    engene::EnGeneConfig config;
+    config.title = "Transform Hierarchy Stress Test - Static Subtrees";
+    config.width = 1280;
+    config.height = 720;
+    config.clearColor[0] = 0.1f;
+    config.clearColor[1] = 0.1f;
+    config.clearColor[2] = 0.15f;
+    config.clearColor[3] = 1.0f;
+
+    try {
+        engene::EnGene app(on_init, on_update, on_render, config, handler);
+        std::cout << "\n[RUNNING] Transform hierarchy stress test" << std::endl;
+        app.run();
+
+        std::cout << "\n✓ Test completed successfully!" << std::endl;
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Test failed: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
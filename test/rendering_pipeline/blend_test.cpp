@@ -1,5 +1,6 @@
 #include <iostream>
 #include <memory>
+#include <vector>
 #include <EnGene.h>
 #include <core/scene_node_builder.h>
 #include <components/all.h>
@@ -65,6 +66,7 @@ const char* BLEND_TEST_FRAGMENT_SHADER = R"(
  * - Blend function configuration (source and destination factors)
  * - Separate RGB/Alpha blending
  * - Constant color blending
+ * - Back-to-front draw order for alpha-blended geometry
  * - State inheritance across framebuffer push/pop
  * - Hierarchical blend state management
  * - No OpenGL errors during blend operations
@@ -106,6 +108,9 @@ bool g_phase_changed = false;
 geometry::GeometryPtr g_cube_geom;
 framebuffer::FramebufferPtr g_fbo;
 
+// Cube transforms in cube order (cube1..cubeN), animated directly in on_update
+std::vector<std::shared_ptr<transform::Transform>> g_cube_transforms;
+
 /**
  * @brief Test Phase 1: Basic alpha blending
  * 
@@ -334,42 +339,48 @@ int main() {
         std::cout << "✓ Cube geometry created" << std::endl;
         
         // Create scene with multiple overlapping cubes
-        // Cube 1: Red, semi-transparent
-        auto mat1 = material::Material::Make(glm::vec3(1.0f, 0.0f, 0.0f));
-        mat1->set("color", glm::vec4(1.0f, 0.0f, 0.0f, 0.5f));
+        // SrcAlpha/OneMinusSrcAlpha only composites correctly back-to-front, and the
+        // graph draws in insertion order, so the cubes are added farthest first.
+        // The camera is fixed looking down -Z, so this order holds every frame.
         
-        scene::graph()->addNode("cube1")
-            .with<component::TransformComponent>(
-                transform::Transform::Make()
-                    ->setTranslate(-1.0f, 0.0f, -5.0f)
-            )
-            .with<component::MaterialComponent>(mat1)
+        // Cube 3: Blue, semi-transparent
+        auto mat3 = material::Material::Make(glm::vec3(0.0f, 0.0f, 1.0f));
+        mat3->set("color", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
+        
+        auto cube3_transform = transform::Transform::Make();
+        cube3_transform->setTranslate(1.0f, 0.0f, -6.0f);
+        
+        scene::graph()->addNode("cube3")
+            .with<component::TransformComponent>(cube3_transform)
+            .with<component::MaterialComponent>(mat3)
             .with<component::GeometryComponent>(g_cube_geom);
         
         // Cube 2: Green, semi-transparent
         auto mat2 = material::Material::Make(glm::vec3(0.0f, 1.0f, 0.0f));
         mat2->set("color", glm::vec4(0.0f, 1.0f, 0.0f, 0.5f));
         
+        auto cube2_transform = transform::Transform::Make();
+        cube2_transform->setTranslate(0.0f, 0.0f, -5.5f);
+        
         scene::graph()->addNode("cube2")
-            .with<component::TransformComponent>(
-                transform::Transform::Make()
-                    ->setTranslate(0.0f, 0.0f, -5.5f)
-            )
+            .with<component::TransformComponent>(cube2_transform)
             .with<component::MaterialComponent>(mat2)
             .with<component::GeometryComponent>(g_cube_geom);
         
-        // Cube 3: Blue, semi-transparent
-        auto mat3 = material::Material::Make(glm::vec3(0.0f, 0.0f, 1.0f));
-        mat3->set("color", glm::vec4(0.0f, 0.0f, 1.0f, 0.5f));
+        // Cube 1: Red, semi-transparent
+        auto mat1 = material::Material::Make(glm::vec3(1.0f, 0.0f, 0.0f));
+        mat1->set("color", glm::vec4(1.0f, 0.0f, 0.0f, 0.5f));
         
-        scene::graph()->addNode("cube3")
-            .with<component::TransformComponent>(
-                transform::Transform::Make()
-                    ->setTranslate(1.0f, 0.0f, -6.0f)
-            )
-            .with<component::MaterialComponent>(mat3)
+        auto cube1_transform = transform::Transform::Make();
+        cube1_transform->setTranslate(-1.0f, 0.0f, -5.0f);
+        
+        scene::graph()->addNode("cube1")
+            .with<component::TransformComponent>(cube1_transform)
+            .with<component::MaterialComponent>(mat1)
             .with<component::GeometryComponent>(g_cube_geom);
         
+        g_cube_transforms = {cube1_transform, cube2_transform, cube3_transform};
+        
         std::cout << "✓ Scene created with 3 overlapping transparent cubes" << std::endl;
         
         // Create perspective camera
@@ -425,23 +436,16 @@ int main() {
         }
         
         // Update cube rotations
-        for (int i = 1; i <= 3; i++) {
-            std::string node_name = "cube" + std::to_string(i);
-            auto cube_node = scene::graph()->getNodeByName(node_name);
-            if (cube_node) {
-                auto transform_comp = cube_node->payload().get<component::TransformComponent>();
-                if (transform_comp) {
-                    auto transform = transform_comp->getTransform();
-                    transform->rotate(
-                        static_cast<float>(dt * 30.0 * i),  // Different rotation speeds
-                        0.0f, 1.0f, 0.0f
-                    );
-                    transform->rotate(
-                        static_cast<float>(dt * 20.0 * i),
-                        1.0f, 0.0f, 0.0f
-                    );
-                }
-            }
+        for (size_t i = 1; i <= g_cube_transforms.size(); i++) {
+            auto& transform = g_cube_transforms[i - 1];
+            transform->rotate(
+                static_cast<float>(dt * 30.0 * i),  // Different rotation speeds
+                0.0f, 1.0f, 0.0f
+            );
+            transform->rotate(
+                static_cast<float>(dt * 20.0 * i),
+                1.0f, 0.0f, 0.0f
+            );
         }
     };
     
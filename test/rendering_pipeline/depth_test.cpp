@@ -1,5 +1,6 @@
 #include <iostream>
 #include <memory>
+#include <vector>
 #include <EnGene.h>
 #include <core/scene_node_builder.h>
 #include <components/all.h>
@@ -111,6 +112,9 @@ int g_depth_range_index = 0;
 geometry::GeometryPtr g_cube_geom;
 framebuffer::FramebufferPtr g_fbo;
 
+// Cube transforms in node order (cube1..cubeN), animated directly in on_update
+std::vector<std::shared_ptr<transform::Transform>> g_cube_transforms;
+
 // Depth function names for display
 const char* g_depth_func_names[] = {
     "Less (default)",
@@ -391,11 +395,12 @@ int main() {
         auto mat1 = material::Material::Make(glm::vec3(1.0f, 0.0f, 0.0f));
         mat1->set("color", glm::vec4(1.0f, 0.0f, 0.0f, 1.0f));
         
+        auto cube1_transform = transform::Transform::Make();
+        cube1_transform->setTranslate(-1.5f, 0.0f, -4.0f);
+        g_cube_transforms.push_back(cube1_transform);
+        
         scene::graph()->addNode("cube1")
-            .with<component::TransformComponent>(
-                transform::Transform::Make()
-                    ->setTranslate(-1.5f, 0.0f, -4.0f)
-            )
+            .with<component::TransformComponent>(cube1_transform)
             .with<component::MaterialComponent>(mat1)
             .with<component::GeometryComponent>(g_cube_geom);
         
@@ -403,11 +408,12 @@ int main() {
         auto mat2 = material::Material::Make(glm::vec3(0.0f, 1.0f, 0.0f));
         mat2->set("color", glm::vec4(0.0f, 1.0f, 0.0f, 1.0f));
         
+        auto cube2_transform = transform::Transform::Make();
+        cube2_transform->setTranslate(0.0f, 0.0f, -5.0f);
+        g_cube_transforms.push_back(cube2_transform);
+        
         scene::graph()->addNode("cube2")
-            .with<component::TransformComponent>(
-                transform::Transform::Make()
-                    ->setTranslate(0.0f, 0.0f, -5.0f)
-            )
+            .with<component::TransformComponent>(cube2_transform)
             .with<component::MaterialComponent>(mat2)
             .with<component::GeometryComponent>(g_cube_geom);
         
@@ -415,11 +421,12 @@ int main() {
         auto mat3 = material::Material::Make(glm::vec3(0.0f, 0.0f, 1.0f));
         mat3->set("color", glm::vec4(0.0f, 0.0f, 1.0f, 1.0f));
         
+        auto cube3_transform = transform::Transform::Make();
+        cube3_transform->setTranslate(1.5f, 0.0f, -6.0f);
+        g_cube_transforms.push_back(cube3_transform);
+        
         scene::graph()->addNode("cube3")
-            .with<component::TransformComponent>(
-                transform::Transform::Make()
-                    ->setTranslate(1.5f, 0.0f, -6.0f)
-            )
+            .with<component::TransformComponent>(cube3_transform)
             .with<component::MaterialComponent>(mat3)
             .with<component::GeometryComponent>(g_cube_geom);
         
@@ -427,11 +434,12 @@ int main() {
         auto mat4 = material::Material::Make(glm::vec3(1.0f, 1.0f, 0.0f));
         mat4->set("color", glm::vec4(1.0f, 1.0f, 0.0f, 1.0f));
         
+        auto cube4_transform = transform::Transform::Make();
+        cube4_transform->setTranslate(0.5f, 0.5f, -5.2f);
+        g_cube_transforms.push_back(cube4_transform);
+        
         scene::graph()->addNode("cube4")
-            .with<component::TransformComponent>(
-                transform::Transform::Make()
-                    ->setTranslate(0.5f, 0.5f, -5.2f)
-            )
+            .with<component::TransformComponent>(cube4_transform)
             .with<component::MaterialComponent>(mat4)
             .with<component::GeometryComponent>(g_cube_geom);
         
@@ -439,11 +447,12 @@ int main() {
         auto mat5 = material::Material::Make(glm::vec3(0.0f, 1.0f, 1.0f));
         mat5->set("color", glm::vec4(0.0f, 1.0f, 1.0f, 1.0f));
         
+        auto cube5_transform = transform::Transform::Make();
+        cube5_transform->setTranslate(-1.0f, -0.5f, -4.3f);
+        g_cube_transforms.push_back(cube5_transform);
+        
         scene::graph()->addNode("cube5")
-            .with<component::TransformComponent>(
-                transform::Transform::Make()
-                    ->setTranslate(-1.0f, -0.5f, -4.3f)
-            )
+            .with<component::TransformComponent>(cube5_transform)
             .with<component::MaterialComponent>(mat5)
             .with<component::GeometryComponent>(g_cube_geom);
         
@@ -451,12 +460,13 @@ int main() {
         auto mat6 = material::Material::Make(glm::vec3(1.0f, 0.0f, 1.0f));
         mat6->set("color", glm::vec4(1.0f, 0.0f, 1.0f, 1.0f));
         
+        auto cube6_transform = transform::Transform::Make();
+        cube6_transform->setTranslate(0.0f, 0.0f, -110.0f);  // Far plane is at 100.0
+        cube6_transform->scale(50.0f, 50.0f, 1.0f);  // Make it a big wall
+        g_cube_transforms.push_back(cube6_transform);
+        
         scene::graph()->addNode("cube6")
-            .with<component::TransformComponent>(
-                transform::Transform::Make()
-                    ->setTranslate(0.0f, 0.0f, -110.0f)  // Far plane is at 100.0
-                    ->scale(50.0f, 50.0f, 1.0f)  // Make it a big wall
-            )
+            .with<component::TransformComponent>(cube6_transform)
             .with<component::MaterialComponent>(mat6)
             .with<component::GeometryComponent>(g_cube_geom);
         
@@ -509,23 +519,16 @@ int main() {
         }
         
         // Update cube rotations
-        for (int i = 1; i <= 6; i++) {
-            std::string node_name = "cube" + std::to_string(i);
-            auto cube_node = scene::graph()->getNodeByName(node_name);
-            if (cube_node) {
-                auto transform_comp = cube_node->payload().get<component::TransformComponent>();
-                if (transform_comp) {
-                    auto transform = transform_comp->getTransform();
-                    transform->rotate(
-                        static_cast<float>(dt * 20.0 * i),  // Different rotation speeds
-                        0.0f, 1.0f, 0.0f
-                    );
-                    transform->rotate(
-                        static_cast<float>(dt * 15.0 * i),
-                        1.0f, 0.0f, 0.0f
-                    );
-                }
-            }
+        for (size_t i = 1; i <= g_cube_transforms.size(); i++) {
+            auto& transform = g_cube_transforms[i - 1];
+            transform->rotate(
+                static_cast<float>(dt * 20.0 * i),  // Different rotation speeds
+                0.0f, 1.0f, 0.0f
+            );
+            transform->rotate(
+                static_cast<float>(dt * 15.0 * i),
+                1.0f, 0.0f, 0.0f
+            );
         }
     };
     
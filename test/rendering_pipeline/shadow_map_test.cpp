@@ -0,0 +1,298 @@
+#include <iostream>
+#include <vector>
+#include <EnGene.h>
+#include <core/scene_node_builder.h>
+#include <components/all.h>
+#include <gl_base/error.h>
+#include <gl_base/framebuffer.h>
+#include <gl_base/material.h>
+#include <gl_base/transform.h>
+#include <3d/camera/perspective_camera.h>
+#include <other_genes/3d_shapes/cube.h>
+#include <other_genes/input_handlers/arcball_input_handler.h>
+
+/**
+ * @brief Shadow map test: a depth-only light pass with one minimal shared shader.
+ *
+ * The casters are drawn twice per frame. The first pass goes into a
+ * depth-only framebuffer from the directional light's point of view, using
+ * SHADOW_DEPTH shaders that only transform positions: no material uniforms,
+ * no lighting, an empty fragment stage. The second pass is the normal
+ * camera view, where the lit shader compares each fragment's light-space
+ * depth against the shadow map (3x3 PCF).
+ *
+ * Each caster's Transform is shared between its depth-pass node and its
+ * main-pass node, so one update moves both.
+ *
+ * This test validates:
+ * - Depth attachment with texture storage, sampled in a later pass
+ * - Depth-only FramebufferComponent subtree drawn before the main scene
+ * - One depth shader shared by every caster instead of the material shaders
+ *
+ * Expected Result:
+ * - Spinning cubes casting moving shadows onto the ground and each other
+ * - No shadow acne on the ground plane
+ * - No OpenGL errors
+ *
+ * Controls:
+ * - Left Mouse Button + Drag: Rotate camera (orbit)
+ * - Mouse Wheel: Zoom in/out
+ * - ESC: Exit
+ */
+
+const int SHADOW_MAP_SIZE = 2048;
+const glm::vec3 LIGHT_DIRECTION(-0.5f, -1.0f, -0.3f);
+
+// Depth pass: position only
+const char* SHADOW_DEPTH_VERTEX_SHADER = R"(
+    #version 410 core
+    layout (location = 0) in vec4 vertex;
+
+    uniform mat4 u_model;
+    uniform mat4 u_lightViewProj;
+
+    void main() {
+        gl_Position = u_lightViewProj * u_model * vertex;
+    }
+)";
+
+const char* SHADOW_DEPTH_FRAGMENT_SHADER = R"(
+    #version 410 core
+
+    void main() {
+        // Depth is written by the fixed-function stage
+    }
+)";
+
+// Main pass: lambert lighting attenuated by the shadow map
+const char* SHADOW_LIT_VERTEX_SHADER = R"(
+    #version 410 core
+    layout (location = 0) in vec4 vertex;
+    layout (location = 1) in vec3 normal;
+
+    out vec3 fragNormal;
+    out vec4 lightSpacePos;
+
+    layout (std140) uniform CameraMatrices {
+        mat4 view;
+        mat4 projection;
+    };
+
+    uniform mat4 u_model;
+    uniform mat4 u_lightViewProj;
+
+    void main() {
+        vec4 worldPos = u_model * vertex;
+        fragNormal = mat3(transpose(inverse(u_model))) * normal;
+        lightSpacePos = u_lightViewProj * worldPos;
+        gl_Position = projection * view * worldPos;
+    }
+)";
+
+const char* SHADOW_LIT_FRAGMENT_SHADER = R"(
+    #version 410 core
+
+    in vec3 fragNormal;
+    in vec4 lightSpacePos;
+    out vec4 fragColor;
+
+    uniform vec4 color;
+    uniform vec3 u_lightDir;
+    uniform sampler2D u_shadowMap;
+
+    float shadowFactor(vec3 n, vec3 l) {
+        vec3 coords = lightSpacePos.xyz / lightSpacePos.w * 0.5 + 0.5;
+        if (coords.z > 1.0) return 1.0;
+
+        // Slope-scaled bias against acne on surfaces grazing the light
+        float bias = max(0.005 * (1.0 - dot(n, l)), 0.0005);
+        vec2 texel = 1.0 / vec2(textureSize(u_shadowMap, 0));
+        float lit = 0.0;
+        for (int x = -1; x <= 1; x++) {
+            for (int y = -1; y <= 1; y++) {
+                float closest = texture(u_shadowMap, coords.xy + vec2(x, y) * texel).r;
+                lit += coords.z - bias > closest ? 0.0 : 1.0;
+            }
+        }
+        return lit / 9.0;
+    }
+
+    void main() {
+        vec3 n = normalize(fragNormal);
+        vec3 l = normalize(-u_lightDir);
+        float diff = max(dot(n, l), 0.0);
+        fragColor = vec4((0.25 + diff * shadowFactor(n, l)) * color.rgb, color.a);
+    }
+)";
+
+struct CasterSpec {
+    glm::vec3 position;
+    glm::vec4 color;
+};
+
+const CasterSpec CASTERS[] = {
+    {glm::vec3(-2.0f, 1.0f, 0.0f), glm::vec4(1.0f, 0.3f, 0.3f, 1.0f)},
+    {glm::vec3(0.5f, 2.0f, -1.0f), glm::vec4(0.3f, 1.0f, 0.3f, 1.0f)},
+    {glm::vec3(2.0f, 0.8f, 1.5f), glm::vec4(0.3f, 0.3f, 1.0f, 1.0f)},
+    {glm::vec3(0.0f, 3.5f, 1.0f), glm::vec4(1.0f, 1.0f, 0.3f, 1.0f)}
+};
+
+int main() {
+    std::cout << "=== Shadow Map Test ===" << std::endl;
+    std::cout << "Testing: depth-only light pass with a shared minimal shader" << std::endl;
+    std::cout << "Expected: Spinning cubes casting shadows onto the ground" << std::endl;
+    std::cout << std::endl;
+
+    auto* handler = new input::InputHandler();
+    std::shared_ptr<arcball::ArcBallController> arcball_handler;
+
+    // Caster transforms, shared by the depth and main passes
+    std::vector<std::shared_ptr<transform::Transform>> caster_transforms;
+
+    // Light pass target, cleared by on_render before each frame's draw
+    framebuffer::FramebufferPtr shadow_fbo;
+
+    auto on_init = [&](engene::EnGene& app) {
+        std::cout << "[INIT] Creating shadow framebuffer..." << std::endl;
+
+        std::vector<framebuffer::Framebuffer::AttachmentSpec> specs = {
+            framebuffer::Framebuffer::AttachmentSpec(
+                framebuffer::attachment::Point::Depth,
+                framebuffer::attachment::Format::DepthComponent24,
+                framebuffer::attachment::StorageType::Texture,
+                "shadow_depth")
+        };
+        shadow_fbo = framebuffer::Framebuffer::Make(SHADOW_MAP_SIZE, SHADOW_MAP_SIZE, specs);
+        if (!shadow_fbo || !shadow_fbo->hasTexture("shadow_depth")) {
+            throw exception::FramebufferException("Failed to create shadow framebuffer");
+        }
+        auto shadow_map = shadow_fbo->getTexture("shadow_depth");
+        std::cout << "✓ Depth-only framebuffer created (" << SHADOW_MAP_SIZE << "x" << SHADOW_MAP_SIZE << ")" << std::endl;
+
+        // Orthographic light frustum covering the ground plane
+        glm::vec3 light_dir = glm::normalize(LIGHT_DIRECTION);
+        glm::mat4 light_view = glm::lookAt(-light_dir * 15.0f, glm::vec3(0.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+        glm::mat4 light_proj = glm::ortho(-10.0f, 10.0f, -10.0f, 10.0f, 1.0f, 30.0f);
+        glm::mat4 light_view_proj = light_proj * light_view;
+
+        auto depth_shader = shader::Shader::Make(SHADOW_DEPTH_VERTEX_SHADER, SHADOW_DEPTH_FRAGMENT_SHADER);
+        depth_shader->configureDynamicUniform<glm::mat4>("u_model", transform::current);
+        depth_shader->setUniform<glm::mat4>("u_lightViewProj", light_view_proj);
+        depth_shader->Bake();
+
+        auto lit_shader = shader::Shader::Make(SHADOW_LIT_VERTEX_SHADER, SHADOW_LIT_FRAGMENT_SHADER);
+        lit_shader->configureDynamicUniform<glm::mat4>("u_model", transform::current);
+        lit_shader->configureDynamicUniform<glm::vec4>("color", material::stack()->getProvider<glm::vec4>("color"));
+        lit_shader->configureDynamicUniform<uniform::detail::Sampler>(
+            "u_shadowMap",
+            texture::getSamplerProvider("u_shadowMap")
+        );
+        lit_shader->setUniform<glm::mat4>("u_lightViewProj", light_view_proj);
+        lit_shader->setUniform<glm::vec3>("u_lightDir", light_dir);
+        std::cout << "✓ Depth and lit shaders created" << std::endl;
+
+        auto cube_geom = Cube::Make(1.0f, 1.0f, 1.0f);
+        auto ground_geom = Cube::Make(16.0f, 0.2f, 16.0f);
+
+        auto ground_transform = transform::Transform::Make();
+        ground_transform->setTranslate(0.0f, -0.1f, 0.0f);
+
+        // Pass 1: casters into the shadow map, all with the depth shader
+        auto& shadow_pass = scene::graph()->addNode("shadow_pass")
+            .with<component::FramebufferComponent>(shadow_fbo)
+            .with<component::ShaderComponent>(depth_shader);
+
+        // Pass 2: the camera view, sampling the shadow map
+        auto& lit_pass = scene::graph()->addNode("lit_pass")
+            .with<component::ShaderComponent>(lit_shader)
+            .with<component::TextureComponent>(shadow_map, "u_shadowMap", 0);
+
+        auto ground_material = material::Material::Make(glm::vec3(0.7f, 0.7f, 0.7f));
+        ground_material->set("color", glm::vec4(0.7f, 0.7f, 0.7f, 1.0f));
+        lit_pass.addNode("ground")
+            .with<component::TransformComponent>(ground_transform)
+            .with<component::MaterialComponent>(ground_material)
+            .with<component::GeometryComponent>(ground_geom);
+
+        for (size_t i = 0; i < sizeof(CASTERS) / sizeof(CASTERS[0]); i++) {
+            auto caster_transform = transform::Transform::Make();
+            caster_transform->setTranslate(CASTERS[i].position.x, CASTERS[i].position.y, CASTERS[i].position.z);
+            caster_transforms.push_back(caster_transform);
+
+            std::string name = "caster" + std::to_string(i + 1);
+            shadow_pass.addNode(name + "_depth")
+                .with<component::TransformComponent>(caster_transform)
+                .with<component::GeometryComponent>(cube_geom);
+
+            auto caster_material = material::Material::Make(glm::vec3(CASTERS[i].color));
+            caster_material->set("color", CASTERS[i].color);
+            lit_pass.addNode(name)
+                .with<component::TransformComponent>(caster_transform)
+                .with<component::MaterialComponent>(caster_material)
+                .with<component::GeometryComponent>(cube_geom);
+        }
+        std::cout << "✓ Ground and " << caster_transforms.size() << " casters added to both passes" << std::endl;
+
+        framebuffer::stack()->depth().setTest(true);
+        framebuffer::stack()->depth().setWrite(true);
+        framebuffer::stack()->depth().setFunction(framebuffer::DepthFunc::Less);
+
+        // Create camera
+        auto camera = component::PerspectiveCamera::Make(60.0f, 0.1f, 100.0f);
+        camera->getTransform()->setTranslate(0.0f, 6.0f, 12.0f);
+        scene::graph()->setActiveCamera(camera);
+        scene::graph()->getActiveCamera()->bindToShader(lit_shader);
+        lit_shader->Bake();
+
+        std::cout << "✓ Camera created" << std::endl;
+
+        // Attach arcball controls
+        arcball_handler = arcball::attachArcballTo(*handler);
+
+        std::cout << "✓ Arcball controller initialized" << std::endl;
+    };
+
+    auto on_update = [&](double dt) {
+        for (size_t i = 0; i < caster_transforms.size(); i++) {
+            float speed = static_cast<float>(i + 1);
+            caster_transforms[i]->rotate(static_cast<float>(dt * 20.0) * speed, 0.0f, 1.0f, 0.0f);
+            caster_transforms[i]->rotate(static_cast<float>(dt * 15.0) * speed, 1.0f, 0.0f, 0.0f);
+        }
+    };
+
+    auto on_render = [&](double alpha) {
+        // The shadow pass only draws into shadow_fbo, so last frame's depth has to go first
+        framebuffer::stack()->push(shadow_fbo);
+        glClear(GL_DEPTH_BUFFER_BIT);
+        framebuffer::stack()->pop();
+
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        scene::graph()->draw();
+        GL_CHECK("render");
+    };
+
+    engene::EnGeneConfig config;
+    config.title = "Shadow Map Test - Depth-Only Light Pass";
+    config.width = 1280;
+    config.height = 720;
+    config.clearColor[0] = 0.1f;
+    config.clearColor[1] = 0.1f;
+    config.clearColor[2] = 0.15f;
+    config.clearColor[3] = 1.0f;
+
+    try {
+        engene::EnGene app(on_init, on_update, on_render, config, handler);
+        std::cout << "\n[RUNNING] Shadow map test" << std::endl;
+        app.run();
+
+        std::cout << "\n✓ Test completed successfully!" << std::endl;
+    } catch (const exception::FramebufferException& e) {
+        std::cerr << "✗ Framebuffer error: " << e.what() << std::endl;
+        return 1;
+    } catch (const std::exception& e) {
+        std::cerr << "✗ Test failed: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
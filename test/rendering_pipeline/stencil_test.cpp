@@ -52,6 +52,9 @@ bool g_phase_changed = false;
 geometry::GeometryPtr g_cube_geom;
 framebuffer::FramebufferPtr g_fbo;
 
+// Animated transform, kept here so updates don't look the node up by name
+std::shared_ptr<transform::Transform> g_cube_transform;
+
 /**
  * @brief Test Phase 1: Write to stencil buffer
  * 
@@ -221,11 +224,11 @@ int main() {
         std::cout << "✓ Cube geometry created" << std::endl;
         
         // Create scene with rotating cube
+        g_cube_transform = transform::Transform::Make();
+        g_cube_transform->setTranslate(0.0f, 0.0f, -5.0f);
+        
         scene::graph()->addNode("rotating_cube")
-            .with<component::TransformComponent>(
-                transform::Transform::Make()
-                    ->setTranslate(0.0f, 0.0f, -5.0f)
-            )
+            .with<component::TransformComponent>(g_cube_transform)
             .with<component::GeometryComponent>(g_cube_geom);
         
         std::cout << "✓ Scene created" << std::endl;
@@ -275,21 +278,14 @@ int main() {
         }
         
         // Update cube rotation
-        auto cube_node = scene::graph()->getNodeByName("rotating_cube");
-        if (cube_node) {
-            auto transform_comp = cube_node->payload().get<component::TransformComponent>();
-            if (transform_comp) {
-                auto transform = transform_comp->getTransform();
-                transform->rotate(
-                    static_cast<float>(dt * 50.0),  // Rotate around Y axis
-                    0.0f, 1.0f, 0.0f
-                );
-                transform->rotate(
-                    static_cast<float>(dt * 30.0),  // Rotate around X axis
-                    1.0f, 0.0f, 0.0f
-                );
-            }
-        }
+        g_cube_transform->rotate(
+            static_cast<float>(dt * 50.0),  // Rotate around Y axis
+            0.0f, 1.0f, 0.0f
+        );
+        g_cube_transform->rotate(
+            static_cast<float>(dt * 30.0),  // Rotate around X axis
+            1.0f, 0.0f, 0.0f
+        );
     };
     
     auto on_render = [](double alpha) {